@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace {
+
+// the elements inserted one at a time, as a baseline for the bulk inserts
+template <typename List>
+void insert_one_by_one(benchmark::State &state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    for(auto _ : state) {
+        List list;
+        auto pos = list.before_begin();
+
+        for(std::size_t i = 0; i < count; ++i) {
+            pos = list.insert_after(pos, std::uint32_t{7});
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void construct_count(benchmark::State &state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    for(auto _ : state) {
+        List list(count, std::uint32_t{7});
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void insert_range(benchmark::State &state) {
+    std::vector<std::uint32_t> source(static_cast<std::size_t>(state.range(0)),
+            7);
+
+    for(auto _ : state) {
+        List list;
+        list.insert_after(list.before_begin(), source.begin(), source.end());
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using List = mystd::ForwardList<std::uint32_t>;
+using PoolList = mystd::ForwardList<std::uint32_t,
+      mystd::NodePoolAllocator<std::uint32_t>>;
+
+} //end anonymous namespace
+
+BENCHMARK(insert_one_by_one<List>)->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(construct_count<List>)->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(insert_range<List>)->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(insert_one_by_one<PoolList>)
+    ->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(construct_count<PoolList>)
+    ->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(insert_range<PoolList>)->RangeMultiplier(10)->Range(100, 1000000);
@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace {
+
+// a list whose nodes are in allocation order but whose links jump around,
+// as after a sort of random keys
+template <typename List>
+List make_scattered(std::size_t count) {
+    std::mt19937 engine(42);
+    List list;
+
+    for(std::size_t i = 0; i < count; ++i) {
+        list.push_front(engine());
+    }
+
+    list.sort();
+    return list;
+}
+
+template <typename List>
+void iterate(benchmark::State &state, bool compacted) {
+    List list = make_scattered<List>(static_cast<std::size_t>(state.range(0)));
+
+    if(compacted) {
+        list.compact();
+    }
+
+    for(auto _ : state) {
+        std::uint64_t sum = std::accumulate(list.begin(), list.end(),
+                std::uint64_t{0});
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.counters["fragmentation"] = list.fragmentation();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void iterate_scattered(benchmark::State &state) {
+    iterate<List>(state, false);
+}
+
+template <typename List>
+void iterate_compacted(benchmark::State &state) {
+    iterate<List>(state, true);
+}
+
+template <typename List>
+void compact(benchmark::State &state) {
+    for(auto _ : state) {
+        state.PauseTiming();
+        List list = make_scattered<List>(
+                static_cast<std::size_t>(state.range(0)));
+        state.ResumeTiming();
+
+        list.compact();
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using List = mystd::ForwardList<std::uint32_t>;
+using PoolList = mystd::ForwardList<std::uint32_t, 
+      mystd::NodePoolAllocator<std::uint32_t>>;
+
+} //end anonymous namespace
+
+BENCHMARK(iterate_scattered<List>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(iterate_compacted<List>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(iterate_scattered<PoolList>)
+    ->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(iterate_compacted<PoolList>)
+    ->RangeMultiplier(10)->Range(1000, 1000000);
+
+BENCHMARK(compact<List>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(compact<PoolList>)->RangeMultiplier(10)->Range(1000, 1000000);
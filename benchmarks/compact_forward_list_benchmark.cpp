@@ -0,0 +1,63 @@
+#include <cstdint>
+#include <numeric>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "compact_forward_list.hpp"
+#include "forward_list.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace {
+
+template <typename List>
+void push_front(benchmark::State &state) {
+    for(auto _ : state) {
+        List list;
+
+        for(std::int64_t i = 0; i < state.range(0); ++i) {
+            list.push_front(static_cast<std::uint32_t>(i));
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// the links are scrambled by sorting random keys before the traversal
+template <typename List>
+void iterate_sorted(benchmark::State &state) {
+    std::mt19937 engine(42);
+    List list;
+
+    for(std::int64_t i = 0; i < state.range(0); ++i) {
+        list.push_front(engine());
+    }
+
+    list.sort();
+
+    for(auto _ : state) {
+        std::uint64_t sum = std::accumulate(list.begin(), list.end(),
+                std::uint64_t{0});
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using List = mystd::ForwardList<std::uint32_t>;
+using PoolList = mystd::ForwardList<std::uint32_t,
+      mystd::NodePoolAllocator<std::uint32_t>>;
+using CompactList = mystd::CompactForwardList<std::uint32_t>;
+
+} //end anonymous namespace
+
+BENCHMARK(push_front<List>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(push_front<PoolList>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(push_front<CompactList>)->RangeMultiplier(10)->Range(1000, 1000000);
+
+BENCHMARK(iterate_sorted<List>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(iterate_sorted<PoolList>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(iterate_sorted<CompactList>)
+    ->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,100 @@
+#include <mutex>
+#include <optional>
+
+#include <benchmark/benchmark.h>
+
+#include "concurrent_forward_list.hpp"
+#include "forward_list.hpp"
+
+namespace {
+
+// the work list we replace: a ForwardList behind a mutex
+class LockedForwardList {
+public:
+    void push_front(int value) {
+        std::lock_guard lock(mutex_);
+        list_.push_front(value);
+    }
+
+    std::optional<int> pop_front() {
+        std::lock_guard lock(mutex_);
+
+        if(list_.empty()) {
+            return std::nullopt;
+        }
+
+        int value = list_.front();
+        list_.pop_front();
+        return value;
+    }
+
+private:
+    std::mutex mutex_;
+    mystd::ForwardList<int> list_;
+};
+
+// every thread pushes a burst of work items and pops as many
+template <typename List>
+void push_pop(benchmark::State &state) {
+    static List *list = nullptr;
+    const auto burst = static_cast<int>(state.range(0));
+
+    if(state.thread_index() == 0) {
+        list = new List();
+    }
+
+    for(auto _ : state) {
+        for(int i = 0; i < burst; ++i) {
+            list->push_front(i);
+        }
+
+        for(int i = 0; i < burst; ++i) {
+            benchmark::DoNotOptimize(list->pop_front());
+        }
+    }
+
+    if(state.thread_index() == 0) {
+        delete list;
+    }
+
+    state.SetItemsProcessed(state.iterations() * burst * 2);
+}
+
+// producers hand over prepared chains, the consumer takes everything at once
+void chain_handoff(benchmark::State &state) {
+    static mystd::ConcurrentForwardList<int> *list = nullptr;
+    const auto chain_size = static_cast<int>(state.range(0));
+
+    if(state.thread_index() == 0) {
+        list = new mystd::ConcurrentForwardList<int>();
+    }
+
+    for(auto _ : state) {
+        if(state.thread_index() == 0) {
+            benchmark::DoNotOptimize(list->take_all());
+            continue;
+        }
+
+        mystd::ForwardList<int> chain;
+        for(int i = 0; i < chain_size; ++i) {
+            chain.push_front(i);
+        }
+
+        list->push_front_chain(std::move(chain));
+    }
+
+    if(state.thread_index() == 0) {
+        delete list;
+    }
+
+    state.SetItemsProcessed(state.iterations() * chain_size);
+}
+
+} //end anonymous namespace
+
+BENCHMARK(push_pop<mystd::ConcurrentForwardList<int>>)
+    ->Arg(16)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(push_pop<LockedForwardList>)
+    ->Arg(16)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK(chain_handoff)->Arg(64)->ThreadRange(2, 16)->UseRealTime();
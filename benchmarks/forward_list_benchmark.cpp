@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+
+namespace {
+
+// 64 byte payload that is cheap to copy but fills a cache line
+struct Pod64 {
+    std::uint64_t key;
+    std::uint64_t padding[7];
+
+    bool operator == (const Pod64 &rhs) const { return key == rhs.key; }
+    bool operator < (const Pod64 &rhs) const { return key < rhs.key; }
+};
+
+static_assert(sizeof(Pod64) == 64);
+
+template <typename T>
+T make_value(std::uint64_t key);
+
+template <>
+int make_value<int>(std::uint64_t key) {
+    return static_cast<int>(key);
+}
+
+template <>
+Pod64 make_value<Pod64>(std::uint64_t key) {
+    return Pod64{key, {}};
+}
+
+template <>
+std::string make_value<std::string>(std::uint64_t key) {
+    return "key_" + std::to_string(key) + "_with_a_longer_tail";
+}
+
+std::uint64_t key(int value) { return static_cast<std::uint64_t>(value); }
+std::uint64_t key(const Pod64 &value) { return value.key; }
+std::uint64_t key(const std::string &value) { return value[4]; }
+
+// count random values, keys are taken modulo distinct if it is not zero
+template <typename T>
+std::vector<T> make_values(std::size_t count, std::uint64_t distinct = 0) {
+    std::mt19937 engine(42);
+    std::vector<T> values;
+    values.reserve(count);
+
+    for(std::size_t i = 0; i < count; ++i) {
+        std::uint64_t key = engine();
+        values.push_back(make_value<T>(distinct ? key % distinct : key));
+    }
+
+    return values;
+}
+
+template <typename List>
+using value_t = typename List::value_type;
+
+std::size_t size(const benchmark::State &state) {
+    return static_cast<std::size_t>(state.range(0));
+}
+
+template <typename List>
+void construction(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+
+    for(auto _ : state) {
+        List list(values.begin(), values.end());
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void push_front(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+
+    for(auto _ : state) {
+        List list;
+
+        for(const auto &value : values) {
+            list.push_front(value);
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void insert_after(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+
+    for(auto _ : state) {
+        List list;
+        auto pos = list.before_begin();
+
+        for(const auto &value : values) {
+            pos = list.insert_after(pos, value);
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//erases every second element
+template <typename List>
+void erase_after(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        List list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        auto it = list.begin();
+        while(it != list.end() && std::next(it) != list.end()) {
+            it = list.erase_after(it);
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void remove_if(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        List list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.remove_if([](const auto &value) { return key(value) % 2 == 0; });
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//about three quarters of the sorted elements are duplicates
+template <typename List>
+void unique(benchmark::State &state) {
+    auto values = make_values<value_t<List>>(size(state), size(state) / 4 + 1);
+    std::sort(values.begin(), values.end());
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        List list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.unique();
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void reverse(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+    List list(values.begin(), values.end());
+
+    for(auto _ : state) {
+        list.reverse();
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//merges two sorted lists of half the size
+template <typename List>
+void merge(benchmark::State &state) {
+    auto values = make_values<value_t<List>>(size(state));
+    auto middle = values.begin() + values.size() / 2;
+    std::sort(values.begin(), middle);
+    std::sort(middle, values.end());
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        List list(values.begin(), middle);
+        List other(middle, values.end());
+        state.ResumeTiming();
+
+        list.merge(other);
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void sort(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        List list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.sort();
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//moves the whole list back and forth between two lists
+template <typename List>
+void splice_after(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+    List first(values.begin(), values.end());
+    List second;
+    List *from = &first;
+    List *to = &second;
+
+    for(auto _ : state) {
+        to->splice_after(to->before_begin(), *from);
+        benchmark::DoNotOptimize(to->begin());
+        std::swap(from, to);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//assigns to a list of the same size, so the nodes could be reused
+template <typename List>
+void copy_assignment(benchmark::State &state) {
+    const auto values = make_values<value_t<List>>(size(state));
+    const List source(values.begin(), values.end());
+    List list(values.rbegin(), values.rend());
+
+    for(auto _ : state) {
+        list = source;
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// the larger payloads stop at 10^6 elements to keep the memory usage of the
+// setup (values, source list and result) within a few hundred megabytes
+constexpr std::int64_t max_int_size = 10'000'000;
+constexpr std::int64_t max_payload_size = 1'000'000;
+
+} //end anonymous namespace
+
+#define MYSTD_LIST_BENCHMARK(operation, T, max_size) \
+    BENCHMARK(operation<mystd::ForwardList<T>>) \
+        ->RangeMultiplier(10)->Range(10, max_size); \
+    BENCHMARK(operation<std::forward_list<T>>) \
+        ->RangeMultiplier(10)->Range(10, max_size)
+
+#define MYSTD_LIST_BENCHMARKS(operation) \
+    MYSTD_LIST_BENCHMARK(operation, int, max_int_size); \
+    MYSTD_LIST_BENCHMARK(operation, Pod64, max_payload_size); \
+    MYSTD_LIST_BENCHMARK(operation, std::string, max_payload_size)
+
+MYSTD_LIST_BENCHMARKS(construction);
+MYSTD_LIST_BENCHMARKS(push_front);
+MYSTD_LIST_BENCHMARKS(insert_after);
+MYSTD_LIST_BENCHMARKS(erase_after);
+MYSTD_LIST_BENCHMARKS(remove_if);
+MYSTD_LIST_BENCHMARKS(unique);
+MYSTD_LIST_BENCHMARKS(reverse);
+MYSTD_LIST_BENCHMARKS(merge);
+MYSTD_LIST_BENCHMARKS(sort);
+MYSTD_LIST_BENCHMARKS(splice_after);
+MYSTD_LIST_BENCHMARKS(copy_assignment);
@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "mapped_forward_list.hpp"
+
+namespace {
+
+struct Record {
+    std::uint64_t key;
+    std::uint64_t value;
+};
+
+std::filesystem::path list_path(std::int64_t count) {
+    return std::filesystem::temp_directory_path()
+        / ("mystd_mapped_benchmark_" + std::to_string(count) + ".list");
+}
+
+// what we replace: the elements are read and linked one by one
+void rebuild(benchmark::State &state) {
+    std::vector<Record> records(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        mystd::ForwardList<Record> list;
+        auto pos = list.before_begin();
+
+        for(const Record &record : records) {
+            pos = list.insert_after(pos, record);
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// opening the file and reading the first element
+void reopen(benchmark::State &state) {
+    std::filesystem::path path = list_path(state.range(0));
+    std::filesystem::remove(path);
+
+    {
+        mystd::MappedForwardList<Record> list(path);
+        list.reserve(static_cast<std::size_t>(state.range(0)));
+        auto pos = list.before_begin();
+
+        for(std::int64_t i = 0; i < state.range(0); ++i) {
+            pos = list.insert_after(pos, Record{std::uint64_t(i), 0});
+        }
+    }
+
+    for(auto _ : state) {
+        mystd::MappedForwardList<Record> list(path);
+        benchmark::DoNotOptimize(list.front());
+    }
+
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void push_front(benchmark::State &state) {
+    std::filesystem::path path = list_path(state.range(0));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        std::filesystem::remove(path);
+        mystd::MappedForwardList<Record> list(path);
+        state.ResumeTiming();
+
+        for(std::int64_t i = 0; i < state.range(0); ++i) {
+            list.push_front(Record{std::uint64_t(i), 0});
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} //end anonymous namespace
+
+BENCHMARK(rebuild)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(reopen)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(push_front)->RangeMultiplier(10)->Range(1000, 1000000);
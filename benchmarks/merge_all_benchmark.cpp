@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "forward_list_algorithm.hpp"
+
+namespace {
+
+using List = mystd::ForwardList<std::uint64_t>;
+
+// state.range(0) elements spread over state.range(1) sorted lists
+std::vector<List> make_lists(const benchmark::State &state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto lists_count = static_cast<std::size_t>(state.range(1));
+    std::mt19937_64 engine(42);
+    std::vector<std::vector<std::uint64_t>> values(lists_count);
+
+    for(std::size_t i = 0; i < count; ++i) {
+        values[i % lists_count].push_back(engine());
+    }
+
+    std::vector<List> lists;
+    lists.reserve(lists_count);
+
+    for(auto &run : values) {
+        std::sort(run.begin(), run.end());
+        lists.emplace_back(run.begin(), run.end());
+    }
+
+    return lists;
+}
+
+//merges every list into the first one, as merge() allows
+void pairwise_merge(benchmark::State &state) {
+    for(auto _ : state) {
+        state.PauseTiming();
+        auto lists = make_lists(state);
+        state.ResumeTiming();
+
+        for(std::size_t i = 1; i < lists.size(); ++i) {
+            lists.front().merge(lists[i]);
+        }
+
+        benchmark::DoNotOptimize(lists.front());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void merge_all(benchmark::State &state) {
+    for(auto _ : state) {
+        state.PauseTiming();
+        auto lists = make_lists(state);
+        state.ResumeTiming();
+
+        List merged = mystd::merge_all(lists);
+        benchmark::DoNotOptimize(merged);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_merge_all(benchmark::State &state) {
+    for(auto _ : state) {
+        state.PauseTiming();
+        auto lists = make_lists(state);
+        state.ResumeTiming();
+
+        List merged = mystd::merge_all(mystd::par, lists);
+        benchmark::DoNotOptimize(merged);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} //end anonymous namespace
+
+BENCHMARK(pairwise_merge)->ArgsProduct({{1 << 16, 1 << 20}, {4, 16, 64}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(merge_all)->ArgsProduct({{1 << 16, 1 << 20}, {4, 16, 64}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(parallel_merge_all)->ArgsProduct({{1 << 16, 1 << 20}, {4, 16, 64}})
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
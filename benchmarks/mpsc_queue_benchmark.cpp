@@ -0,0 +1,70 @@
+#include <mutex>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "mpsc_queue.hpp"
+
+namespace {
+
+// the handoff we replace: a ForwardList behind a mutex, appending at the
+// tail and handing the whole list to the consumer
+class LockedQueue {
+public:
+    void push(int value) {
+        std::lock_guard lock(mutex_);
+        list_.push_back(value);
+    }
+
+    auto drain() {
+        std::lock_guard lock(mutex_);
+        return std::exchange(list_, {});
+    }
+
+private:
+    std::mutex mutex_;
+    mystd::ForwardList<int, std::allocator<int>, mystd::track_tail> list_;
+};
+
+// thread 0 consumes in batches, all other threads produce
+template <typename Queue>
+void handoff(benchmark::State &state) {
+    static Queue *queue = nullptr;
+    const auto burst = static_cast<int>(state.range(0));
+
+    if(state.thread_index() == 0) {
+        queue = new Queue();
+    }
+
+    for(auto _ : state) {
+        if(state.thread_index() == 0) {
+            auto batch = queue->drain();
+            benchmark::DoNotOptimize(batch.begin());
+            continue;
+        }
+
+        for(int i = 0; i < burst; ++i) {
+            queue->push(i);
+        }
+    }
+
+    if(state.thread_index() == 0) {
+        delete queue;
+    } else {
+        state.SetItemsProcessed(state.iterations() * burst);
+    }
+}
+
+void producer_counts(benchmark::internal::Benchmark *benchmark) {
+    for(int producers = 1; producers <= 16; producers *= 2) {
+        benchmark->Threads(producers + 1);
+    }
+}
+
+} //end anonymous namespace
+
+BENCHMARK(handoff<mystd::MpscQueue<int>>)
+    ->Arg(64)->Apply(producer_counts)->UseRealTime();
+BENCHMARK(handoff<LockedQueue>)
+    ->Arg(64)->Apply(producer_counts)->UseRealTime();
@@ -0,0 +1,64 @@
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace {
+
+template <typename Alloc>
+void push_pop_front(benchmark::State &state) {
+    const auto count = static_cast<int>(state.range(0));
+    mystd::ForwardList<int, Alloc> list;
+
+    for(auto _ : state) {
+        for(int i = 0; i < count; ++i) {
+            list.push_front(i);
+        }
+
+        benchmark::DoNotOptimize(list.front());
+
+        for(int i = 0; i < count; ++i) {
+            list.pop_front();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count * 2);
+}
+
+template <typename Alloc>
+void remove_if_churn(benchmark::State &state) {
+    const auto count = static_cast<int>(state.range(0));
+    mystd::ForwardList<int, Alloc> list;
+
+    for(auto _ : state) {
+        for(int i = 0; i < count; ++i) {
+            list.push_front(i);
+        }
+
+        benchmark::DoNotOptimize(list.remove_if([](int value) {
+            return value % 2 == 0;
+        }));
+
+        list.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+} //end anonymous namespace
+
+BENCHMARK(push_pop_front<std::allocator<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(push_pop_front<mystd::NodePoolAllocator<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(push_pop_front<mystd::NodePoolAllocator<int, false>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK(remove_if_churn<std::allocator<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(remove_if_churn<mystd::NodePoolAllocator<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(remove_if_churn<mystd::NodePoolAllocator<int, false>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
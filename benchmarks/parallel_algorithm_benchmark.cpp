@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "forward_list_algorithm.hpp"
+
+namespace {
+
+using List = mystd::ForwardList<double>;
+using SizedList = mystd::ForwardList<double, std::allocator<double>,
+      mystd::list_policy::track_size>;
+
+template <typename L>
+L make_list(std::size_t count) {
+    std::vector<double> values(count);
+    std::iota(values.begin(), values.end(), 1.0);
+    return L(values.begin(), values.end());
+}
+
+//a few dozen cycles per element, like a small real transform
+double work(double value) {
+    return std::sqrt(value) * std::log(value);
+}
+
+template <typename L>
+void for_each(benchmark::State &state) {
+    L list = make_list<L>(static_cast<std::size_t>(state.range(0)));
+    mystd::parallel_policy policy{static_cast<unsigned>(state.range(1))};
+
+    for(auto _ : state) {
+        mystd::parallel_for_each(policy, list, [](double &value) {
+            value = work(value);
+        });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void transform_reduce(benchmark::State &state) {
+    const List list = make_list<List>(static_cast<std::size_t>(state.range(0)));
+    mystd::parallel_policy policy{static_cast<unsigned>(state.range(1))};
+
+    for(auto _ : state) {
+        double sum = mystd::transform_reduce(policy, list, 0.0,
+                std::plus<>{}, work);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void count_if(benchmark::State &state) {
+    const List list = make_list<List>(static_cast<std::size_t>(state.range(0)));
+    mystd::parallel_policy policy{static_cast<unsigned>(state.range(1))};
+
+    for(auto _ : state) {
+        std::size_t count = mystd::count_if(policy, list, [](double value) {
+            return work(value) > 10.0;
+        });
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//the serial loop the algorithms are measured against
+void serial_transform_reduce(benchmark::State &state) {
+    const List list = make_list<List>(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        double sum = std::transform_reduce(list.begin(), list.end(), 0.0,
+                std::plus<>{}, work);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void thread_counts(benchmark::internal::Benchmark *benchmark) {
+    for(int threads = 1; threads <= 32; threads *= 2) {
+        benchmark->Args({1 << 22, threads});
+    }
+}
+
+} //end anonymous namespace
+
+BENCHMARK(serial_transform_reduce)->Arg(1 << 22)
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK(for_each<List>)->Apply(thread_counts)->ArgNames({"size", "threads"})
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(for_each<SizedList>)->Apply(thread_counts)
+    ->ArgNames({"size", "threads"})
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(transform_reduce)->Apply(thread_counts)
+    ->ArgNames({"size", "threads"})
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(count_if)->Apply(thread_counts)->ArgNames({"size", "threads"})
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
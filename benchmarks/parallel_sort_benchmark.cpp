@@ -0,0 +1,54 @@
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+
+namespace {
+
+void parallel_sort(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto threads = static_cast<unsigned>(state.range(1));
+
+    std::mt19937 engine(42);
+    std::vector<int> values(count);
+    for(auto &value : values) {
+        value = static_cast<int>(engine());
+    }
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        mystd::ForwardList<int> list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.sort(mystd::parallel_policy{threads});
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void thread_counts(benchmark::internal::Benchmark *benchmark) {
+    const auto hardware = static_cast<int>(
+            mystd::parallel_policy{}.thread_count());
+
+    for(int threads = 1; threads < hardware; threads *= 2) {
+        benchmark->Args({1 << 22, threads});
+    }
+
+    benchmark->Args({1 << 22, hardware});
+}
+
+} //end anonymous namespace
+
+BENCHMARK(parallel_sort)
+    ->Apply(thread_counts)
+    ->ArgNames({"size", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
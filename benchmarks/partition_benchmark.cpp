@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace {
+
+// the pool hands out the nodes of a range insert as one run, so every
+// benchmark starts from a list that is laid out in order
+using List = mystd::ForwardList<std::uint64_t,
+      mystd::NodePoolAllocator<std::uint64_t>>;
+
+List make_list(std::size_t count) {
+    std::mt19937_64 engine(42);
+    std::vector<std::uint64_t> values(count);
+
+    for(auto &value : values) {
+        value = engine();
+    }
+
+    return List(values.begin(), values.end());
+}
+
+//copies the elements of every part and removes them, one pass per part.
+//The lists are destroyed while the timer is paused
+void copy_partition(benchmark::State &state) {
+    auto parts = static_cast<std::size_t>(state.range(1));
+    std::vector<List> lists;
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        lists.clear();
+        List list = make_list(static_cast<std::size_t>(state.range(0)));
+        state.ResumeTiming();
+
+        lists.resize(parts);
+
+        for(std::size_t i = 0; i < parts; ++i) {
+            auto tail = lists[i].before_begin();
+
+            for(std::uint64_t value : list) {
+                if(value % parts == i) {
+                    tail = lists[i].insert_after(tail, value);
+                }
+            }
+
+            list.remove_if([parts, i](std::uint64_t value) {
+                return value % parts == i;
+            });
+        }
+
+        benchmark::DoNotOptimize(lists);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void partition_into(benchmark::State &state) {
+    auto parts = static_cast<std::size_t>(state.range(1));
+    std::vector<List> lists;
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        lists.clear();
+        List list = make_list(static_cast<std::size_t>(state.range(0)));
+        state.ResumeTiming();
+
+        lists = list.partition_into(parts, [parts](std::uint64_t value) {
+            return value % parts;
+        });
+
+        benchmark::DoNotOptimize(lists);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} //end anonymous namespace
+
+BENCHMARK(copy_partition)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {4, 16}});
+BENCHMARK(partition_into)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {4, 16}});
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "rcu_forward_list.hpp"
+
+namespace {
+
+constexpr int table_size = 64;
+// thread 0 also updates one entry every that many lookups
+constexpr int update_period = 1024;
+
+// the routing table we replace: a ForwardList behind a shared lock
+class LockedTable {
+public:
+    LockedTable() : list_(table_size) {}
+
+    bool contains(int key) const {
+        std::shared_lock lock(mutex_);
+        return std::find(list_.begin(), list_.end(), key) != list_.end();
+    }
+
+    void update(int key) {
+        std::unique_lock lock(mutex_);
+        list_.front() = key;
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    mystd::ForwardList<int> list_;
+};
+
+class RcuTable {
+public:
+    RcuTable() {
+        for(int i = 0; i < table_size; ++i) {
+            list_.push_front(0);
+        }
+    }
+
+    bool contains(int key) const {
+        auto view = list_.read();
+        return std::find(view.begin(), view.end(), key) != view.end();
+    }
+
+    void update(int key) {
+        list_.replace_after(list_.before_begin(), key);
+    }
+
+private:
+    mystd::RcuForwardList<int> list_;
+};
+
+template <typename Table>
+void lookup(benchmark::State &state) {
+    static Table *table = nullptr;
+
+    if(state.thread_index() == 0) {
+        table = new Table();
+    }
+
+    int key = 0;
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(table->contains(++key % table_size));
+
+        if(state.thread_index() == 0 && key % update_period == 0) {
+            table->update(key % table_size);
+        }
+    }
+
+    if(state.thread_index() == 0) {
+        delete table;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} //end anonymous namespace
+
+BENCHMARK(lookup<RcuTable>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(lookup<LockedTable>)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,138 @@
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "forward_list.hpp"
+#include "forward_list_io.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace {
+
+struct Record {
+    std::uint64_t key;
+    std::uint64_t value;
+};
+
+struct StringCodec {
+    void encode(const std::string &value, mystd::BinaryWriter &out) {
+        out.write_value(value.size());
+        out.write(value.data(), value.size());
+    }
+
+    std::string decode(mystd::BinaryReader &in) {
+        std::string value(in.read_value<std::size_t>(), '\0');
+        in.read(value.data(), value.size());
+        return value;
+    }
+};
+
+template <typename List>
+List make_list(std::int64_t count) {
+    List list;
+
+    for(std::int64_t i = 0; i < count; ++i) {
+        list.push_front({std::uint64_t(i), std::uint64_t(i)});
+    }
+
+    return list;
+}
+
+// what we replace: one unbuffered stream write per element
+void save_per_element(benchmark::State &state) {
+    auto list = make_list<mystd::ForwardList<Record>>(state.range(0));
+
+    for(auto _ : state) {
+        std::ostringstream out;
+
+        for(const Record &record : list) {
+            out.write(reinterpret_cast<const char *>(&record), sizeof(record));
+        }
+
+        benchmark::DoNotOptimize(out.tellp());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0)
+            * std::int64_t(sizeof(Record)));
+}
+
+void save_stream(benchmark::State &state) {
+    auto list = make_list<mystd::ForwardList<Record>>(state.range(0));
+
+    for(auto _ : state) {
+        std::ostringstream out;
+        mystd::save(out, list);
+        benchmark::DoNotOptimize(out.tellp());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0)
+            * std::int64_t(sizeof(Record)));
+}
+
+void save_fd(benchmark::State &state) {
+    auto list = make_list<mystd::ForwardList<Record>>(state.range(0));
+    int fd = ::open("/dev/null", O_WRONLY);
+
+    for(auto _ : state) {
+        mystd::save(fd, list);
+    }
+
+    ::close(fd);
+    state.SetBytesProcessed(state.iterations() * state.range(0)
+            * std::int64_t(sizeof(Record)));
+}
+
+template <typename List>
+void load_stream(benchmark::State &state) {
+    std::stringstream data;
+    mystd::save(data, make_list<List>(state.range(0)));
+    const std::string bytes = data.str();
+
+    for(auto _ : state) {
+        std::istringstream in(bytes);
+        List list;
+        mystd::load(in, list);
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0)
+            * std::int64_t(sizeof(Record)));
+}
+
+void save_codec(benchmark::State &state) {
+    mystd::ForwardList<std::string> list;
+
+    for(std::int64_t i = 0; i < state.range(0); ++i) {
+        list.push_front("element_" + std::to_string(i));
+    }
+
+    std::int64_t bytes = 0;
+
+    for(auto _ : state) {
+        std::ostringstream out;
+        mystd::save(out, list, StringCodec{});
+        bytes += out.tellp();
+    }
+
+    state.SetBytesProcessed(bytes);
+}
+
+using List = mystd::ForwardList<Record>;
+using PoolList = mystd::ForwardList<Record, mystd::NodePoolAllocator<Record>>;
+
+} //end anonymous namespace
+
+BENCHMARK(save_per_element)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(save_stream)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(save_fd)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(load_stream<List>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(load_stream<PoolList>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(save_codec)->RangeMultiplier(10)->Range(1000, 1000000);
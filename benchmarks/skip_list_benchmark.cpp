@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "node_pool_allocator.hpp"
+#include "skip_list.hpp"
+
+namespace {
+
+std::vector<std::uint32_t> make_keys(std::size_t count) {
+    std::mt19937 engine(42);
+    std::vector<std::uint32_t> keys(count);
+
+    for(auto &key : keys) {
+        key = engine();
+    }
+
+    return keys;
+}
+
+// a sorted ForwardList finds the insertion point with a linear scan
+struct SortedList {
+    mystd::ForwardList<std::uint32_t> list;
+
+    void insert(std::uint32_t key) {
+        auto prev = list.before_begin();
+
+        for(auto curr = list.begin(); curr != list.end() && *curr < key;
+                ++curr)
+        {
+            prev = curr;
+        }
+
+        list.insert_after(prev, key);
+    }
+
+    bool contains(std::uint32_t key) const {
+        auto it = std::find_if(list.begin(), list.end(),
+                [key](std::uint32_t value) { return value >= key; });
+        return it != list.end() && *it == key;
+    }
+};
+
+template <typename Set>
+void insert(benchmark::State &state) {
+    const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        Set set;
+
+        for(std::uint32_t key : keys) {
+            set.insert(key);
+        }
+
+        benchmark::DoNotOptimize(set);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Set>
+void find(benchmark::State &state) {
+    const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    Set set;
+
+    for(std::uint32_t key : keys) {
+        set.insert(key);
+    }
+
+    for(auto _ : state) {
+        std::size_t found = 0;
+
+        for(std::uint32_t key : keys) {
+            found += set.contains(key);
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Set>
+void iterate(benchmark::State &state) {
+    const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    Set set(keys.begin(), keys.end());
+
+    for(auto _ : state) {
+        std::uint64_t sum = 0;
+
+        for(std::uint32_t key : set) {
+            sum += key;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using SkipList = mystd::SkipList<std::uint32_t>;
+using PoolSkipList = mystd::SkipList<std::uint32_t, std::less<std::uint32_t>,
+      mystd::NodePoolAllocator<std::uint32_t>>;
+using MultiSet = std::multiset<std::uint32_t>;
+
+} //end anonymous namespace
+
+BENCHMARK(insert<SortedList>)->RangeMultiplier(8)->Range(1 << 6, 1 << 12);
+BENCHMARK(insert<SkipList>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK(insert<PoolSkipList>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK(insert<MultiSet>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+
+BENCHMARK(find<SortedList>)->RangeMultiplier(8)->Range(1 << 6, 1 << 12);
+BENCHMARK(find<SkipList>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK(find<MultiSet>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+
+BENCHMARK(iterate<SkipList>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK(iterate<MultiSet>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
@@ -0,0 +1,191 @@
+#include <cstdint>
+#include <forward_list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+
+namespace {
+
+// sorted by its key, the payload makes the nodes as large as a real record
+struct Record {
+    std::uint64_t key;
+    char payload[24];
+
+    bool operator < (const Record &other) const { return key < other.key; }
+};
+
+template <typename T>
+T make_value(std::mt19937 &engine);
+
+template <>
+int make_value<int>(std::mt19937 &engine) {
+    return static_cast<int>(engine());
+}
+
+template <>
+std::uint64_t make_value<std::uint64_t>(std::mt19937 &engine) {
+    return std::uint64_t{engine()} << 32 | engine();
+}
+
+template <>
+Record make_value<Record>(std::mt19937 &engine) {
+    return Record{make_value<std::uint64_t>(engine), {}};
+}
+
+template <>
+std::string make_value<std::string>(std::mt19937 &engine) {
+    return "key_" + std::to_string(engine()) + "_with_a_longer_tail";
+}
+
+template <typename T>
+std::vector<T> make_values(std::size_t count) {
+    std::mt19937 engine(42);
+    std::vector<T> values;
+    values.reserve(count);
+
+    for(std::size_t i = 0; i < count; ++i) {
+        values.push_back(make_value<T>(engine));
+    }
+
+    return values;
+}
+
+template <typename List>
+void sort(benchmark::State &state) {
+    using T = typename List::value_type;
+    const auto values = make_values<T>(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        List list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.sort();
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void gather_sort(benchmark::State &state) {
+    const auto values = make_values<T>(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        mystd::ForwardList<T> list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.sort(mystd::sort_strategy::gather);
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+std::uint64_t key_of(std::uint64_t value) {
+    return value;
+}
+
+std::uint64_t key_of(const Record &record) {
+    return record.key;
+}
+
+template <typename T>
+void radix_sort(benchmark::State &state) {
+    const auto values = make_values<T>(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        mystd::ForwardList<T> list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.radix_sort([](const T &value) { return key_of(value); });
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// top-k of a list, state.range(1) is k
+void partial_sort(benchmark::State &state) {
+    const auto values = make_values<int>(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        mystd::ForwardList<int> list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        list.partial_sort(static_cast<std::size_t>(state.range(1)));
+        benchmark::DoNotOptimize(list.begin());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void nth_element(benchmark::State &state) {
+    const auto values = make_values<int>(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        mystd::ForwardList<int> list(values.begin(), values.end());
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(list.nth_element(values.size() / 2));
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} //end anonymous namespace
+
+BENCHMARK(sort<mystd::ForwardList<int>>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK(sort<std::forward_list<int>>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK(gather_sort<int>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+
+BENCHMARK(sort<mystd::ForwardList<std::string>>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK(sort<std::forward_list<std::string>>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK(gather_sort<std::string>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+
+BENCHMARK(sort<mystd::ForwardList<std::uint64_t>>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK(radix_sort<std::uint64_t>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+
+BENCHMARK(sort<mystd::ForwardList<Record>>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK(radix_sort<Record>)
+    ->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+
+BENCHMARK(partial_sort)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {10, 1000}});
+BENCHMARK(nth_element)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "node_pool_allocator.hpp"
+#include "unordered_map.hpp"
+
+namespace {
+
+std::vector<std::uint64_t> make_keys(std::size_t count) {
+    std::mt19937_64 engine(42);
+    std::vector<std::uint64_t> keys(count);
+
+    for(auto &key : keys) {
+        key = engine();
+    }
+
+    return keys;
+}
+
+template <typename Map>
+void insert(benchmark::State &state) {
+    const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        Map map;
+
+        for(std::uint64_t key : keys) {
+            map.emplace(key, key);
+        }
+
+        benchmark::DoNotOptimize(map);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map>
+void find(benchmark::State &state) {
+    const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    Map map;
+
+    for(std::uint64_t key : keys) {
+        map.emplace(key, key);
+    }
+
+    for(auto _ : state) {
+        std::uint64_t sum = 0;
+
+        for(std::uint64_t key : keys) {
+            sum += map.find(key)->second;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map>
+void erase(benchmark::State &state) {
+    const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        Map map;
+
+        for(std::uint64_t key : keys) {
+            map.emplace(key, key);
+        }
+
+        state.ResumeTiming();
+
+        for(std::uint64_t key : keys) {
+            map.erase(key);
+        }
+
+        benchmark::DoNotOptimize(map);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using Value = std::pair<const std::uint64_t, std::uint64_t>;
+
+using StdMap = std::unordered_map<std::uint64_t, std::uint64_t>;
+using Map = mystd::UnorderedMap<std::uint64_t, std::uint64_t>;
+using PoolMap = mystd::UnorderedMap<std::uint64_t, std::uint64_t,
+      std::hash<std::uint64_t>, std::equal_to<std::uint64_t>,
+      mystd::NodePoolAllocator<Value>>;
+
+} //end anonymous namespace
+
+BENCHMARK(insert<StdMap>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(insert<Map>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(insert<PoolMap>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+BENCHMARK(find<StdMap>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(find<Map>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(find<PoolMap>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+BENCHMARK(erase<StdMap>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(erase<Map>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(erase<PoolMap>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,54 @@
+#include <numeric>
+
+#include <benchmark/benchmark.h>
+
+#include "forward_list.hpp"
+#include "unrolled_forward_list.hpp"
+
+namespace {
+
+template <typename List>
+void iterate(benchmark::State &state) {
+    const auto count = static_cast<int>(state.range(0));
+    List list;
+
+    for(int i = 0; i < count; ++i) {
+        list.push_front(i);
+    }
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(
+                std::accumulate(list.begin(), list.end(), 0L));
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename List>
+void push_front(benchmark::State &state) {
+    const auto count = static_cast<int>(state.range(0));
+
+    for(auto _ : state) {
+        List list;
+
+        for(int i = 0; i < count; ++i) {
+            list.push_front(i);
+        }
+
+        benchmark::DoNotOptimize(list.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+} //end anonymous namespace
+
+BENCHMARK(iterate<mystd::ForwardList<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(iterate<mystd::UnrolledForwardList<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK(push_front<mystd::ForwardList<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(push_front<mystd::UnrolledForwardList<int>>)
+    ->RangeMultiplier(16)->Range(16, 1 << 20);
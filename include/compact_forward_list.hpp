@@ -0,0 +1,998 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "compact_forward_list_node.hpp"
+#include "compact_forward_list_iterator.hpp"
+#include "concepts.hpp"
+
+namespace mystd {
+
+// Singly linked list whose nodes live in one growable array and link each
+// other by Index instead of by pointer. A node of CompactForwardList<int>
+// takes 8 bytes instead of 16 and a traversal stays inside the array.
+// Erased nodes are kept on a free list and reused first.
+//
+// It has the interface of ForwardList with a few differences. Growing the
+// arena moves the elements, so it invalidates the references to them but
+// not the iterators. The iterators refer to the list object, so they don't
+// survive a move or swap of the list. Splicing from another list moves the
+// elements into this arena. At most max_size() elements fit, which is
+// 2^32 - 2 for the default Index.
+template <typename T,
+         typename Index = std::uint32_t,
+         typename Allocator = std::allocator<T>>
+class CompactForwardList {
+    using Node = detail::CompactFwdListNode<T, Index>;
+    using Links = detail::CompactFwdListLinks<T, Index>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+
+    static constexpr Index null_index = detail::null_index<Index>;
+    static constexpr Index before_first = detail::before_first_index<Index>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using index_type = Index;
+
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    using pointer = Traits::pointer;
+    using const_pointer = Traits::const_pointer;
+
+    using size_type = Traits::size_type;
+    using difference_type = Traits::difference_type;
+
+    using iterator = detail::CompactFwdListIterator<false, T, Index>;
+    using const_iterator = detail::CompactFwdListIterator<true, T, Index>;
+
+    CompactForwardList() : CompactForwardList(Allocator{}) {}
+
+    explicit CompactForwardList(const Allocator &alloc) : alloc_(alloc) {}
+
+    CompactForwardList(const CompactForwardList &other);
+
+    CompactForwardList(const CompactForwardList &other,
+            const Allocator &alloc);
+
+    CompactForwardList(CompactForwardList &&other);
+
+    CompactForwardList(CompactForwardList &&other, const Allocator &alloc);
+
+    explicit CompactForwardList(size_type count,
+            const Allocator &alloc = Allocator{});
+
+    CompactForwardList(size_type count,
+            const T &value,
+            const Allocator &alloc = Allocator{});
+
+    CompactForwardList(std::input_iterator auto first,
+            std::input_iterator auto last,
+            const Allocator &alloc = Allocator{});
+
+    CompactForwardList(std::initializer_list<T> ilist,
+            const Allocator &alloc = Allocator{});
+
+    ~CompactForwardList();
+
+    CompactForwardList &operator = (const CompactForwardList &other);
+    CompactForwardList &operator = (CompactForwardList &&other);
+    CompactForwardList &operator = (std::initializer_list<T> ilist);
+
+    Allocator get_allocator() const { return Allocator(alloc_); }
+
+    reference front() { return links_.nodes[links_.head].value(); }
+    const_reference front() const {
+        return links_.nodes[links_.head].value();
+    }
+
+    iterator before_begin() { return iterator(&links_, before_first); }
+    iterator begin() { return iterator(&links_, links_.head); }
+    iterator end() { return iterator(&links_, null_index); }
+
+    const_iterator before_begin() const { return cbefore_begin(); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+    const_iterator cbefore_begin() const {
+        return const_iterator(const_cast<Links *>(&links_), before_first);
+    }
+    const_iterator cbegin() const {
+        return const_iterator(const_cast<Links *>(&links_), links_.head);
+    }
+    const_iterator cend() const {
+        return const_iterator(const_cast<Links *>(&links_), null_index);
+    }
+
+    bool empty() const { return links_.head == null_index; }
+    size_type size() const { return size_; }
+    size_type max_size() const;
+
+    // number of nodes the arena holds without growing
+    size_type capacity() const { return capacity_; }
+    void reserve(size_type count);
+
+    // both move the nodes into list order, so that a traversal walks the
+    // arena forwards, and invalidate all iterators and references.
+    // shrink_to_fit() also frees the capacity that is not used
+    void compact();
+    void shrink_to_fit();
+
+    iterator insert_after(const_iterator pos, const T& value);
+    iterator insert_after(const_iterator pos, T&& value);
+    iterator insert_after(const_iterator pos, size_type count, const T& value);
+    iterator insert_after(const_iterator pos, std::initializer_list<T> ilist);
+    iterator insert_after(const_iterator pos,
+            std::input_iterator auto first,
+            std::input_iterator auto last);
+
+    template<typename ...Args>
+    iterator emplace_after(const_iterator pos, Args &&...args);
+
+    void clear();
+
+    iterator erase_after(const_iterator pos);
+    iterator erase_after(const_iterator first, const_iterator last);
+
+    void push_front(const T &value);
+    void push_front(T &&value);
+
+    template<class... Args>
+    reference emplace_front(Args &&...args);
+
+    void pop_front() { erase_after(before_begin()); };
+
+    void resize(size_type count);
+    void resize(size_type count, const value_type& value);
+
+    void swap(CompactForwardList &other);
+
+    void merge(CompactForwardList &other);
+    void merge(CompactForwardList &&other);
+    void merge(CompactForwardList &other, detail::compare<T> auto comp);
+    void merge(CompactForwardList &&other, detail::compare<T> auto comp);
+
+    void splice_after(const_iterator pos, CompactForwardList &other);
+
+    void splice_after(const_iterator pos, CompactForwardList &other,
+            const_iterator it);
+
+    void splice_after(const_iterator pos, CompactForwardList &other,
+            const_iterator first, const_iterator last);
+
+    size_type remove(const T& value);
+    size_type remove_if(std::predicate<T> auto pred);
+
+    void reverse();
+
+    size_type unique();
+    size_type unique(detail::compare<T> auto pred);
+
+    void sort();
+    void sort(detail::compare<T> auto comp);
+
+    void assign(std::input_iterator auto first, std::input_iterator auto last);
+
+private:
+    // the arena grows by this factor, but to at least min_capacity nodes
+    static constexpr size_type growth_factor = 2;
+    static constexpr size_type min_capacity = 8;
+
+    template <typename ...Args>
+    Index new_node(Index next, Args &&...args);
+    void delete_node(Index index);
+
+    Index take_slot();
+    void free_slot(Index index);
+
+    size_type grown_capacity() const;
+    void reallocate(size_type capacity);
+    void renumber(size_type capacity);
+    void destroy_elements();
+    void release_arena();
+    void steal(CompactForwardList &other);
+
+    Links links_;
+    Index free_ = null_index;
+    // the slots from used_ on were never part of the list
+    Index used_ = 0;
+    Index capacity_ = 0;
+    Index size_ = 0;
+    NodeAlloc alloc_;
+};
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        const CompactForwardList &other)
+    : CompactForwardList(other,
+        Traits::select_on_container_copy_construction(other.get_allocator()))
+{}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        const CompactForwardList &other,
+        const Alloc &alloc)
+    : CompactForwardList(alloc)
+{
+    reserve(other.size());
+    insert_after(before_begin(), other.begin(), other.end());
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        CompactForwardList &&other)
+    : alloc_(std::move(other.alloc_))
+{
+    steal(other);
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        CompactForwardList &&other,
+        const Alloc &alloc)
+    : CompactForwardList(alloc)
+{
+    if(NodeTraits::is_always_equal::value || alloc_ == other.alloc_) {
+        steal(other);
+    } else {
+        reserve(other.size());
+        insert_after(before_begin(),
+                std::move_iterator(other.begin()),
+                std::move_iterator(other.end()));
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        size_type count,
+        const Alloc &alloc)
+    : CompactForwardList(alloc)
+{
+    resize(count);
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        size_type count,
+        const T &value,
+        const Alloc &alloc)
+    : CompactForwardList(alloc)
+{
+    reserve(count);
+    insert_after(before_begin(), count, value);
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        std::input_iterator auto first,
+        std::input_iterator auto last,
+        const Alloc &alloc)
+    : CompactForwardList(alloc)
+{
+    insert_after(before_begin(), first, last);
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::CompactForwardList(
+        std::initializer_list<T> ilist,
+        const Alloc &alloc)
+    : CompactForwardList(alloc)
+{
+    reserve(ilist.size());
+    insert_after(before_begin(), ilist);
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::~CompactForwardList() {
+    release_arena();
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc> &
+CompactForwardList<T, Index, Alloc>::operator = (
+        const CompactForwardList &other)
+{
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    if(NodeTraits::propagate_on_container_copy_assignment::value
+            && alloc_ != other.alloc_) {
+        release_arena();
+        alloc_ = other.alloc_;
+    }
+
+    assign(other.cbegin(), other.cend());
+    return *this;
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc> &
+CompactForwardList<T, Index, Alloc>::operator = (CompactForwardList &&other) {
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    if(NodeTraits::propagate_on_container_move_assignment::value) {
+        release_arena();
+        alloc_ = std::move(other.alloc_);
+        steal(other);
+    } else if(NodeTraits::is_always_equal::value || alloc_ == other.alloc_) {
+        release_arena();
+        steal(other);
+    } else {
+        assign(std::move_iterator(other.begin()),
+               std::move_iterator(other.end()));
+    }
+
+    return *this;
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc> &
+CompactForwardList<T, Index, Alloc>::operator = (
+        std::initializer_list<T> ilist)
+{
+    assign(ilist.begin(), ilist.end());
+    return *this;
+}
+
+//two indices are reserved for the end and the before-begin positions
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::size_type
+CompactForwardList<T, Index, Alloc>::max_size() const {
+    return std::min<size_type>(before_first, NodeTraits::max_size(alloc_));
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::reserve(size_type count) {
+    if(count > max_size()) {
+        throw std::length_error("CompactForwardList: too many elements");
+    }
+
+    if(count > capacity_) {
+        reallocate(count);
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::compact() {
+    renumber(capacity_);
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::shrink_to_fit() {
+    if(size_ < capacity_) {
+        renumber(size_);
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::insert_after(
+        const_iterator pos,
+        const T& value)
+{
+    return emplace_after(pos, value);
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::insert_after(
+        const_iterator pos,
+        T&& value)
+{
+    return emplace_after(pos, std::move(value));
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::insert_after(
+        const_iterator pos,
+        size_type count,
+        const T& value)
+{
+    iterator it(pos.links_, pos.index_);
+
+    for(size_type i = 0; i < count; ++i) {
+        it = emplace_after(it, value);
+    }
+
+    return it;
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::insert_after(
+        const_iterator pos,
+        std::initializer_list<T> ilist)
+{
+    return insert_after(pos, ilist.begin(), ilist.end());
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::insert_after(
+        const_iterator pos,
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    iterator it(pos.links_, pos.index_);
+
+    for(; first != last; ++first) {
+        it = emplace_after(it, *first);
+    }
+
+    return it;
+}
+
+template <typename T, typename Index, typename Alloc>
+template<typename ...Args>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::emplace_after(
+        const_iterator pos,
+        Args &&...args)
+{
+    Index index = new_node(pos.next(), std::forward<Args>(args)...);
+    links_.setNext(pos.index_, index);
+    return iterator(&links_, index);
+}
+
+//the whole arena becomes unused, so the next nodes are taken in order
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::clear() {
+    destroy_elements();
+    links_.head = null_index;
+    free_ = null_index;
+    used_ = 0;
+    size_ = 0;
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::erase_after(const_iterator pos) {
+    Index index = pos.next();
+    links_.setNext(pos.index_, links_.nodes[index].next());
+    delete_node(index);
+    return iterator(&links_, pos.next());
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::iterator
+CompactForwardList<T, Index, Alloc>::erase_after(
+        const_iterator first,
+        const_iterator last)
+{
+    while(first.next() != last.index_) {
+        erase_after(first);
+    }
+
+    return iterator(last.links_, last.index_);
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::push_front(const T &value) {
+    emplace_after(before_begin(), value);
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::push_front(T &&value) {
+    emplace_after(before_begin(), std::move(value));
+}
+
+template <typename T, typename Index, typename Alloc>
+template<typename ...Args>
+CompactForwardList<T, Index, Alloc>::reference
+CompactForwardList<T, Index, Alloc>::emplace_front(Args &&...args) {
+    return *emplace_after(before_begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::resize(size_type count) {
+    iterator it = before_begin();
+    size_type size = 0;
+
+    for(; size < count && std::next(it) != end(); ++size, ++it);
+
+    if(size == count) {
+        erase_after(it, end());
+        return;
+    }
+
+    reserve(size_ + (count - size));
+
+    for(; size < count; ++size) {
+        it = emplace_after(it);
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::resize(
+        size_type count,
+        const value_type &value)
+{
+    iterator it = before_begin();
+    size_type size = 0;
+
+    for(; size < count && std::next(it) != end(); ++size, ++it);
+
+    if(size == count) {
+        erase_after(it, end());
+        return;
+    }
+
+    reserve(size_ + (count - size));
+    insert_after(it, count - size, value);
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::swap(CompactForwardList &other) {
+    std::swap(links_, other.links_);
+    std::swap(free_, other.free_);
+    std::swap(used_, other.used_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+
+    if constexpr(NodeTraits::propagate_on_container_swap::value) {
+        std::swap(alloc_, other.alloc_);
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::merge(CompactForwardList &other) {
+    merge(std::move(other), std::less<T>{});
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::merge(CompactForwardList &&other) {
+    merge(std::move(other), std::less<T>{});
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::merge(
+        CompactForwardList &other,
+        detail::compare<T> auto comp)
+{
+    merge(std::move(other), comp);
+}
+
+//the elements of other are moved into this arena one by one at their place,
+//an element leaves other as soon as it is moved
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::merge(
+        CompactForwardList &&other,
+        detail::compare<T> auto comp)
+{
+    if(std::addressof(*this) == std::addressof(other) || other.empty()) {
+        return;
+    }
+
+    reserve(size() + other.size());
+
+    iterator prev = before_begin();
+
+    while(!other.empty()) {
+        Index curr = prev.next();
+
+        if(curr == null_index || comp(other.front(),
+                    links_.nodes[curr].value()))
+        {
+            prev = emplace_after(prev, std::move(other.front()));
+            other.pop_front();
+        } else {
+            ++prev;
+        }
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::splice_after(
+        const_iterator pos,
+        CompactForwardList &other)
+{
+    if(std::addressof(*this) == std::addressof(other) || other.empty()) {
+        return;
+    }
+
+    reserve(size() + other.size());
+    splice_after(pos, other, other.before_begin(), other.end());
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::splice_after(
+        const_iterator pos,
+        CompactForwardList &other,
+        const_iterator it)
+{
+    Index index = it.next();
+
+    if(std::addressof(*this) != std::addressof(other)) {
+        emplace_after(pos, std::move(other.links_.nodes[index].value()));
+        other.erase_after(it);
+        return;
+    }
+
+    if(pos.index_ == it.index_ || pos.index_ == index) {
+        return;
+    }
+
+    links_.setNext(it.index_, links_.nodes[index].next());
+    links_.setNext(index, pos.next());
+    links_.setNext(pos.index_, index);
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::splice_after(
+        const_iterator pos,
+        CompactForwardList &other,
+        const_iterator first,
+        const_iterator last)
+{
+    if(first.next() == last.index_) {
+        return;
+    }
+
+    if(std::addressof(*this) != std::addressof(other)) {
+        iterator dest(pos.links_, pos.index_);
+
+        while(first.next() != last.index_) {
+            dest = emplace_after(dest,
+                    std::move(other.links_.nodes[first.next()].value()));
+            other.erase_after(first);
+        }
+
+        return;
+    }
+
+    Index begin = first.next();
+    Index end = begin;
+
+    while(links_.nodes[end].next() != last.index_) {
+        end = links_.nodes[end].next();
+    }
+
+    links_.setNext(first.index_, last.index_);
+    links_.setNext(end, pos.next());
+    links_.setNext(pos.index_, begin);
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::size_type
+CompactForwardList<T, Index, Alloc>::remove(const T& value) {
+    return remove_if([&value](const T& element) {
+            return element == value;
+            });
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::size_type
+CompactForwardList<T, Index, Alloc>::remove_if(std::predicate<T> auto pred) {
+    size_type count = 0;
+    iterator prev = before_begin();
+
+    for(Index curr = prev.next(); curr != null_index; curr = prev.next()) {
+        if(pred(links_.nodes[curr].value())) {
+            erase_after(prev);
+            ++count;
+        } else {
+            ++prev;
+        }
+    }
+
+    return count;
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::reverse() {
+    Index prev = null_index;
+    Index curr = links_.head;
+
+    while(curr != null_index) {
+        Index next = links_.nodes[curr].next();
+        links_.nodes[curr].setNext(prev);
+        prev = curr;
+        curr = next;
+    }
+
+    links_.head = prev;
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::size_type
+CompactForwardList<T, Index, Alloc>::unique() {
+    return unique(std::equal_to<T>{});
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::size_type
+CompactForwardList<T, Index, Alloc>::unique(detail::compare<T> auto pred) {
+    if(empty()) {
+        return 0;
+    }
+
+    size_type count = 0;
+    iterator prev = begin();
+
+    for(Index curr = prev.next(); curr != null_index; curr = prev.next()) {
+        if(pred(*prev, links_.nodes[curr].value())) {
+            erase_after(prev);
+            ++count;
+        } else {
+            ++prev;
+        }
+    }
+
+    return count;
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::sort() {
+    sort(std::less<T>{});
+}
+
+//sorts the indices of the nodes and relinks them in that order,
+//the elements stay in their slots
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::sort(detail::compare<T> auto comp) {
+    std::vector<Index> order;
+    order.reserve(size_);
+
+    for(Index index = links_.head; index != null_index;
+            index = links_.nodes[index].next())
+    {
+        order.push_back(index);
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+            [this, &comp](Index lhs, Index rhs) {
+                return comp(links_.nodes[lhs].value(),
+                            links_.nodes[rhs].value());
+            });
+
+    Index prev = before_first;
+
+    for(Index index : order) {
+        links_.setNext(prev, index);
+        prev = index;
+    }
+
+    links_.setNext(prev, null_index);
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::assign(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    iterator dest = before_begin();
+
+    for(; first != last && std::next(dest) != end(); ++first, ++dest) {
+        *std::next(dest) = *first;
+    }
+
+    if(first == last) {
+        erase_after(dest, end());
+    } else {
+        insert_after(dest, first, last);
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+template <typename ...Args>
+Index CompactForwardList<T, Index, Alloc>::new_node(
+        Index next,
+        Args &&...args)
+{
+    if(free_ == null_index && used_ == capacity_) {
+        //the arguments may refer to an element that the growth moves
+        T value(std::forward<Args>(args)...);
+        reallocate(grown_capacity());
+        return new_node(next, std::move(value));
+    }
+
+    Index index = take_slot();
+
+    try {
+        NodeTraits::construct(alloc_, links_.nodes[index].slot(),
+                std::forward<Args>(args)...);
+    } catch(...) {
+        free_slot(index);
+        throw;
+    }
+
+    links_.nodes[index].setNext(next);
+    ++size_;
+    return index;
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::delete_node(Index index) {
+    NodeTraits::destroy(alloc_, std::addressof(links_.nodes[index].value()));
+    free_slot(index);
+    --size_;
+}
+
+//there must be a free slot or unused capacity
+template <typename T, typename Index, typename Alloc>
+Index CompactForwardList<T, Index, Alloc>::take_slot() {
+    if(free_ != null_index) {
+        Index index = free_;
+        free_ = links_.nodes[index].next();
+        return index;
+    }
+
+    return used_++;
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::free_slot(Index index) {
+    links_.nodes[index].setNext(free_);
+    free_ = index;
+}
+
+template <typename T, typename Index, typename Alloc>
+CompactForwardList<T, Index, Alloc>::size_type
+CompactForwardList<T, Index, Alloc>::grown_capacity() const {
+    if(capacity_ == max_size()) {
+        throw std::length_error("CompactForwardList: too many elements");
+    }
+
+    return std::min(std::max(growth_factor * capacity_, min_capacity),
+            max_size());
+}
+
+//moves the elements into a larger arena at the same indices,
+//the old arena is left untouched if a move throws
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::reallocate(size_type capacity) {
+    Node *nodes = NodeTraits::allocate(alloc_, capacity);
+    size_type moved = 0;
+
+    try {
+        for(Index index = links_.head; index != null_index;
+                index = links_.nodes[index].next(), ++moved)
+        {
+            NodeTraits::construct(alloc_, nodes[index].slot(),
+                    std::move_if_noexcept(links_.nodes[index].value()));
+        }
+    } catch(...) {
+        Index index = links_.head;
+
+        for(; moved > 0; --moved, index = links_.nodes[index].next()) {
+            NodeTraits::destroy(alloc_, std::addressof(nodes[index].value()));
+        }
+
+        NodeTraits::deallocate(alloc_, nodes, capacity);
+        throw;
+    }
+
+    //the free slots keep their links too
+    for(Index index = 0; index < used_; ++index) {
+        nodes[index].setNext(links_.nodes[index].next());
+    }
+
+    destroy_elements();
+
+    if(links_.nodes != nullptr) {
+        NodeTraits::deallocate(alloc_, links_.nodes, capacity_);
+    }
+
+    links_.nodes = nodes;
+    capacity_ = static_cast<Index>(capacity);
+}
+
+//moves the elements into a new arena at the indices 0, 1, 2... in list
+//order, so there are no free slots afterwards
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::renumber(size_type capacity) {
+    if(capacity == 0) {
+        release_arena();
+        return;
+    }
+
+    Node *nodes = NodeTraits::allocate(alloc_, capacity);
+    Index count = 0;
+
+    try {
+        for(Index index = links_.head; index != null_index;
+                index = links_.nodes[index].next(), ++count)
+        {
+            NodeTraits::construct(alloc_, nodes[count].slot(),
+                    std::move_if_noexcept(links_.nodes[index].value()));
+        }
+    } catch(...) {
+        for(Index index = 0; index < count; ++index) {
+            NodeTraits::destroy(alloc_, std::addressof(nodes[index].value()));
+        }
+
+        NodeTraits::deallocate(alloc_, nodes, capacity);
+        throw;
+    }
+
+    for(Index index = 0; index < count; ++index) {
+        nodes[index].setNext(index + 1 < count ? index + 1 : null_index);
+    }
+
+    release_arena();
+
+    links_.nodes = nodes;
+    links_.head = count > 0 ? 0 : null_index;
+    used_ = count;
+    capacity_ = static_cast<Index>(capacity);
+    size_ = count;
+}
+
+//the links are left as they are
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::destroy_elements() {
+    for(Index index = links_.head; index != null_index;
+            index = links_.nodes[index].next())
+    {
+        NodeTraits::destroy(alloc_, std::addressof(links_.nodes[index].value()));
+    }
+}
+
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::release_arena() {
+    clear();
+
+    if(links_.nodes != nullptr) {
+        NodeTraits::deallocate(alloc_, links_.nodes, capacity_);
+    }
+
+    links_.nodes = nullptr;
+    capacity_ = 0;
+}
+
+//takes over the arena of other, the arena of this list must be released
+template <typename T, typename Index, typename Alloc>
+void CompactForwardList<T, Index, Alloc>::steal(CompactForwardList &other) {
+    links_ = std::exchange(other.links_, Links{});
+    free_ = std::exchange(other.free_, null_index);
+    used_ = std::exchange(other.used_, 0);
+    capacity_ = std::exchange(other.capacity_, 0);
+    size_ = std::exchange(other.size_, 0);
+}
+
+template <typename T, typename Index, typename Alloc>
+bool operator == (
+        const CompactForwardList<T, Index, Alloc> &lhs,
+        const CompactForwardList<T, Index, Alloc> &rhs)
+{
+    if(std::addressof(lhs) == std::addressof(rhs)) {
+        return true;
+    }
+
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, typename Index, typename Alloc>
+bool operator != (
+        const CompactForwardList<T, Index, Alloc> &lhs,
+        const CompactForwardList<T, Index, Alloc> &rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename T, typename Index, typename Alloc>
+auto operator <=> (
+        const CompactForwardList<T, Index, Alloc> &lhs,
+        const CompactForwardList<T, Index, Alloc> &rhs)
+{
+    return std::lexicographical_compare_three_way(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end()
+        );
+}
+
+} //end namespace mystd
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "forward_list.hpp"
+#include "forward_list_access.hpp"
+#include "forward_list_node.hpp"
+#include "epoch.hpp"
+
+namespace mystd {
+
+// Lock-free LIFO list (Treiber stack) of ForwardList nodes. Any number of
+// threads may push and pop concurrently. Popped nodes are freed only after
+// every thread that could still be reading them has left its critical
+// section, see detail::EpochDomain. Chains move between ForwardList and
+// ConcurrentForwardList without reallocation.
+template <typename T, typename Allocator = std::allocator<T>>
+class ConcurrentForwardList {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+            "pop_front moves the value out of a node that is already unlinked");
+
+    using NodeBase = detail::FwdListNodeBase<T>;
+    using Node = detail::FwdListNode<T>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    using size_type = Traits::size_type;
+
+    ConcurrentForwardList() : ConcurrentForwardList(Allocator{}) {}
+
+    explicit ConcurrentForwardList(const Allocator &alloc) : alloc_(alloc) {}
+
+    ConcurrentForwardList(const ConcurrentForwardList &) = delete;
+    ConcurrentForwardList &operator = (const ConcurrentForwardList &) = delete;
+
+    ~ConcurrentForwardList();
+
+    Allocator get_allocator() const { return Allocator(alloc_); }
+
+    // may be outdated as soon as it returns
+    bool empty() const {
+        return head_.load(std::memory_order_relaxed) == nullptr;
+    }
+
+    void push_front(const T &value);
+    void push_front(T &&value);
+
+    template<typename ...Args>
+    void emplace_front(Args &&...args);
+
+    // links all nodes of list in front in one step, keeping their order
+    template <list_policy Policy>
+    void push_front_chain(ForwardList<T, Allocator, Policy> &&list);
+
+    std::optional<T> pop_front();
+
+    // takes all nodes in one step, they are returned after no other thread
+    // can be reading them any more
+    ForwardList<T, Allocator> take_all();
+
+private:
+    // nodes unlinked before epoch, with their values moved out
+    struct RetiredBatch {
+        std::uint64_t epoch;
+        NodeBase *first;
+    };
+
+    void push_chain(NodeBase *first, NodeBase *last);
+    void retire(NodeBase *node);
+    void reclaim();
+    void destroy_chain(NodeBase *first);
+
+    // every that many popped nodes a reclamation is attempted
+    static constexpr size_type reclaim_period = 64;
+
+    alignas(64) std::atomic<NodeBase *> head_{nullptr};
+    alignas(64) std::atomic<NodeBase *> retired_{nullptr};
+    std::atomic<size_type> retired_count_{0};
+
+    std::mutex reclaim_mutex_;
+    std::vector<RetiredBatch> batches_;
+    NodeAlloc alloc_;
+};
+
+template <typename T, typename Alloc>
+ConcurrentForwardList<T, Alloc>::~ConcurrentForwardList() {
+    destroy_chain(head_.load(std::memory_order_acquire));
+    destroy_chain(retired_.load(std::memory_order_acquire));
+
+    for(RetiredBatch &batch : batches_) {
+        destroy_chain(batch.first);
+    }
+}
+
+template <typename T, typename Alloc>
+void ConcurrentForwardList<T, Alloc>::push_front(const T &value) {
+    emplace_front(value);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentForwardList<T, Alloc>::push_front(T &&value) {
+    emplace_front(std::move(value));
+}
+
+template <typename T, typename Alloc>
+template<typename ...Args>
+void ConcurrentForwardList<T, Alloc>::emplace_front(Args &&...args) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+
+    try {
+        NodeTraits::construct(alloc_, node, nullptr,
+                std::forward<Args>(args)...);
+    } catch(...) {
+        NodeTraits::deallocate(alloc_, node, 1);
+        throw;
+    }
+
+    push_chain(node, node);
+}
+
+template <typename T, typename Alloc>
+template <list_policy Policy>
+void ConcurrentForwardList<T, Alloc>::push_front_chain(
+        ForwardList<T, Alloc, Policy> &&list)
+{
+    if(!NodeTraits::is_always_equal::value
+            && alloc_ != detail::FwdListAccess::node_allocator(list))
+    {
+        ForwardList<T, Alloc> copy(std::move_iterator(list.begin()),
+                std::move_iterator(list.end()), get_allocator());
+        list.clear();
+        push_front_chain(std::move(copy));
+        return;
+    }
+
+    auto [first, last] = detail::FwdListAccess::release(list);
+
+    if(first != nullptr) {
+        push_chain(first, last);
+    }
+}
+
+template <typename T, typename Alloc>
+std::optional<T> ConcurrentForwardList<T, Alloc>::pop_front() {
+    NodeBase *first = nullptr;
+
+    {
+        detail::EpochGuard guard;
+        first = head_.load(std::memory_order_acquire);
+
+        //the link of first may already be reused by the retired list,
+        //then head_ has changed and the exchange fails
+        while(first != nullptr && !head_.compare_exchange_weak(first,
+                    first->loadNext(std::memory_order_relaxed),
+                    std::memory_order_acquire, std::memory_order_acquire));
+    }
+
+    if(first == nullptr) {
+        return std::nullopt;
+    }
+
+    std::optional<T> value(std::move(static_cast<Node *>(first)->value()));
+    retire(first);
+    return value;
+}
+
+template <typename T, typename Alloc>
+ForwardList<T, Alloc> ConcurrentForwardList<T, Alloc>::take_all() {
+    NodeBase *first = head_.exchange(nullptr, std::memory_order_acquire);
+    ForwardList<T, Alloc> list(get_allocator());
+
+    if(first != nullptr) {
+        //a concurrent pop_front may still read the links of the nodes
+        detail::EpochDomain::instance().synchronize();
+        detail::FwdListAccess::adopt(list, first);
+    }
+
+    return list;
+}
+
+template <typename T, typename Alloc>
+void ConcurrentForwardList<T, Alloc>::push_chain(
+        NodeBase *first,
+        NodeBase *last)
+{
+    NodeBase *head = head_.load(std::memory_order_relaxed);
+
+    do {
+        last->setNext(head);
+    } while(!head_.compare_exchange_weak(head, first,
+                std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename T, typename Alloc>
+void ConcurrentForwardList<T, Alloc>::retire(NodeBase *node) {
+    NodeBase *first = retired_.load(std::memory_order_relaxed);
+
+    do {
+        node->storeNext(first, std::memory_order_relaxed);
+    } while(!retired_.compare_exchange_weak(first, node,
+                std::memory_order_release, std::memory_order_relaxed));
+
+    if(retired_count_.fetch_add(1, std::memory_order_relaxed)
+            % reclaim_period == reclaim_period - 1)
+    {
+        reclaim();
+    }
+}
+
+//one thread at a time collects the retired nodes into a batch of the next
+//epoch and frees the batches no thread can be reading any more
+template <typename T, typename Alloc>
+void ConcurrentForwardList<T, Alloc>::reclaim() {
+    std::unique_lock lock(reclaim_mutex_, std::try_to_lock);
+
+    if(!lock.owns_lock()) {
+        return;
+    }
+
+    detail::EpochDomain &domain = detail::EpochDomain::instance();
+    NodeBase *retired = retired_.exchange(nullptr, std::memory_order_acquire);
+
+    if(retired != nullptr) {
+        try {
+            batches_.push_back({domain.advance(), retired});
+        } catch(...) {
+            NodeBase *last = retired;
+            while(last->loadNext(std::memory_order_relaxed) != nullptr) {
+                last = last->loadNext(std::memory_order_relaxed);
+            }
+
+            NodeBase *first = retired_.load(std::memory_order_relaxed);
+            do {
+                last->storeNext(first, std::memory_order_relaxed);
+            } while(!retired_.compare_exchange_weak(first, retired,
+                        std::memory_order_release, std::memory_order_relaxed));
+            return;
+        }
+    }
+
+    std::uint64_t min_active = domain.min_active();
+    auto unreachable = [min_active](const RetiredBatch &batch) {
+        return batch.epoch <= min_active;
+    };
+
+    for(RetiredBatch &batch : batches_) {
+        if(unreachable(batch)) {
+            destroy_chain(batch.first);
+        }
+    }
+
+    batches_.erase(std::remove_if(batches_.begin(), batches_.end(),
+                unreachable), batches_.end());
+}
+
+template <typename T, typename Alloc>
+void ConcurrentForwardList<T, Alloc>::destroy_chain(NodeBase *first) {
+    while(first != nullptr) {
+        Node *node = static_cast<Node *>(first);
+        first = first->loadNext(std::memory_order_relaxed);
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+}
+
+} //end namespace mystd
@@ -1,22 +1,62 @@
 #pragma once 
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "forward_list_node.hpp"
 #include "forward_list_iterator.hpp"
+#include "forward_list_access.hpp"
+#include "forward_list_chain.hpp"
+#include "forward_list_node_handle.hpp"
 #include "concepts.hpp"
+#include "list_policy.hpp"
+#include "parallel.hpp"
+#include "sort_strategy.hpp"
 
 namespace mystd {
 
-template <typename T, typename Allocator = std::allocator<T>>
+template <typename T, 
+         typename Allocator = std::allocator<T>, 
+         list_policy Policy = list_policy::none>
 class ForwardList {
+    friend struct detail::FwdListAccess;
+
     using NodeBase = detail::FwdListNodeBase<T>;
     using Node = detail::FwdListNode<T>;
     using Traits = typename std::allocator_traits<Allocator>;
     using NodeAlloc = typename Traits::template rebind_alloc<Node>;
     using NodeTraits = typename std::allocator_traits<NodeAlloc>;
 
+    static constexpr bool tracks_size = 
+        has_policy(Policy, list_policy::track_size);
+    static constexpr bool tracks_tail = 
+        has_policy(Policy, list_policy::track_tail);
+    static constexpr bool recycles_nodes = 
+        has_policy(Policy, list_policy::recycle_nodes);
+
+    using SizeCounter = std::conditional_t<tracks_size, 
+          typename Traits::size_type, detail::NoSizeCounter>;
+    using TailPointer = std::conditional_t<tracks_tail, 
+          NodeBase *, detail::NoTailPointer>;
+
+    // erased nodes whose values are destroyed, linked through a NodeBase
+    // that is constructed at the start of the node storage
+    struct SpareNodes {
+        NodeBase *first = nullptr;
+        typename Traits::size_type count = 0;
+    };
+
+    using SpareList = std::conditional_t<recycles_nodes, 
+          SpareNodes, detail::NoSpareNodes>;
+
 public:
     using value_type = T;
     using allocator_type = Allocator;
@@ -33,6 +73,8 @@ public:
     using iterator = detail::FwdListIterator<false, T>;
     using const_iterator = detail::FwdListIterator<true, T>;
 
+    using node_type = detail::FwdListNodeHandle<T, Allocator>;
+
     ForwardList();
 
     explicit ForwardList(const Allocator &alloc);
@@ -67,7 +109,14 @@ public:
     Allocator get_allocator() const;
 
     reference front() { return head_.next()->value(); }
-    const_reference front() const { return head_.next()->value; }
+    const_reference front() const { return head_.next()->value(); }
+
+    reference back() requires tracks_tail { 
+        return static_cast<Node *>(tail_)->value(); 
+    }
+    const_reference back() const requires tracks_tail { 
+        return static_cast<const Node *>(tail_)->value(); 
+    }
 
     iterator before_begin() { return iterator(&head_); }
     iterator begin() { return iterator(head_.next()); }
@@ -82,10 +131,17 @@ public:
     const_iterator cend() const { return const_iterator(nullptr); }
 
     bool empty() const { return head_.next() == nullptr; }
+    size_type size() const requires tracks_size { return size_; }
     size_type max_size() const { 
         return std::numeric_limits<difference_type>::max();
     }
 
+    // keeps at least count spare nodes, so that many insertions 
+    // do not allocate
+    void reserve(size_type count) requires recycles_nodes;
+    // deallocates the spare nodes
+    void shrink_to_fit() requires recycles_nodes { release_spare_nodes(); }
+
     iterator insert_after(const_iterator pos, const T& value);
     iterator insert_after(const_iterator pos, T&& value);
     iterator insert_after(const_iterator pos, size_type count, const T& value);
@@ -93,6 +149,12 @@ public:
     iterator insert_after(const_iterator pos, 
             std::input_iterator auto first, 
             std::input_iterator auto last);
+    // relinks the node of the handle, if the allocators are not equal 
+    // the value is moved into a new node instead
+    iterator insert_after(const_iterator pos, node_type &&node);
+
+    // unlinks the element after pos without destroying it
+    node_type extract_after(const_iterator pos);
 
     template<typename ...Args>
     iterator emplace_after(const_iterator pos, Args &&...args);
@@ -110,6 +172,19 @@ public:
 
     void pop_front() { destroy_next_node(before_begin()); };
 
+    void push_back(const T &value) requires tracks_tail { 
+        insert_after(const_iterator(tail_), value); 
+    }
+    void push_back(T &&value) requires tracks_tail { 
+        insert_after(const_iterator(tail_), std::move(value)); 
+    }
+
+    template<class... Args>
+    reference emplace_back(Args &&...args) requires tracks_tail {
+        return *emplace_after(const_iterator(tail_), 
+                std::forward<Args>(args)...);
+    }
+
     void resize(size_type count);
     void resize(size_type count, const value_type& value);
 
@@ -139,79 +214,178 @@ public:
 
     void sort();
     void sort(detail::compare<T> auto comp);
+    void sort(sort_strategy strategy);
+    void sort(sort_strategy strategy, detail::compare<T> auto comp);
+    void sort(parallel_policy policy);
+    void sort(parallel_policy policy, detail::compare<T> auto comp);
+
+    // stable LSD radix sort by an integral key, every pass relinks the
+    // nodes by one byte of the key, O(n * sizeof(key)). Elements are
+    // neither copied nor moved
+    void radix_sort() requires std::integral<T>;
+    void radix_sort(detail::key_extractor<T> auto key);
+
+    // moves the k smallest elements to the front in sorted order, the others
+    // follow in their previous order. O(n log k) comparisons, stable
+    void partial_sort(size_type k);
+    void partial_sort(size_type k, detail::compare<T> auto comp);
+
+    // relinks the nodes so that the element at position n is the one a full
+    // sort would put there, no element before it is greater and none after
+    // it is less. O(n) on typical input, O(n log n) at worst, returns an
+    // iterator to it or end()
+    iterator nth_element(size_type n);
+    iterator nth_element(size_type n, detail::compare<T> auto comp);
+
+    // moves the elements after pos into the returned list by relinking,
+    // O(1) unless the size is tracked, then the moved nodes are counted
+    ForwardList split_after(const_iterator pos);
+
+    // moves every element to the list number key(element) of the n returned
+    // ones in one pass, keeping their relative order. Throws std::out_of_range
+    // if a key is not less than n. If that or key throws, all elements stay
+    // in this list in an unspecified order
+    std::vector<ForwardList> partition_into(size_type n,
+            detail::key_extractor<T> auto key);
 
     void assign(std::input_iterator auto first, std::input_iterator auto last);
 
+    // moves the elements into new nodes allocated in list order and frees
+    // the old ones, so a traversal walks memory forwards. With an allocator
+    // that has allocate_contiguous() the new nodes are adjacent. Invalidates
+    // all iterators and references. Strong guarantee if T has a noexcept
+    // move or a copy constructor
+    void compact();
+
+    // share of the links that jump backwards or further than
+    // fragmentation_distance bytes, one pass over the list
+    double fragmentation() const;
+
+    // compacts if fragmentation() is above threshold, returns whether it did
+    bool compact_if_fragmented(
+            double threshold = default_fragmentation_threshold);
+
+    static constexpr std::size_t fragmentation_distance = 4096;
+    static constexpr double default_fragmentation_threshold = 0.25;
+
 private:
+    // nodes that are linked to each other but not into the list yet
+    struct NodeChain {
+        Node *first = nullptr;
+        Node *last = nullptr;
+        size_type count = 0;
+    };
+
     void insert_empty_after(const_iterator pos, size_type n);
 
-    Node *new_empty_node(NodeBase *next_ = nullptr);
+    // count nodes whose elements make(node) constructs in order, their
+    // storage comes from one allocate_contiguous() call if the allocator
+    // has it. Nothing stays allocated if make throws
+    NodeChain new_chain(size_type count, auto make);
+    NodeChain new_chain(std::input_iterator auto first,
+            std::input_iterator auto last);
+    iterator link_chain_after(const_iterator pos, const NodeChain &chain);
+    // destroys the nodes from first up to last, returns their number
+    size_type delete_chain(NodeBase *first, NodeBase *last);
+
     Node *new_node(NodeBase *next_, const T &value);
     Node *new_node(NodeBase *next_, T &&value);
     
     template <typename ...Args>
     Node *new_emplace_node(NodeBase *next, Args &&...args);
 
+    Node *allocate_node();
+    void deallocate_node(Node *node);
+    void release_spare_nodes();
+    bool same_allocator(const ForwardList &other) const;
+
     size_type crop(size_type count);
+    size_type count_nodes() const;
+    iterator link_after(const_iterator pos, Node *node);
+    Node *unlink_next_node(const_iterator pos);
     void destroy_next_node(const_iterator pos);
-    void sort_impl(ForwardList &list, 
-            size_type size, 
-            detail::compare<T> auto comp);
+
+    // keep size_ and tail_ in step with the links, they compile to nothing
+    // for the disabled policies
+    void linked(NodeBase *pos, NodeBase *last, size_type count);
+    void unlinked(NodeBase *pos, size_type count);
+    void relinked(NodeBase *last);
+    void relinked();
+    void steal(ForwardList &other);
+    void reset();
+
+    void adopt(NodeBase *first);
+    std::pair<NodeBase *, NodeBase *> release();
+
+    static auto node_compare(detail::compare<T> auto &comp);
+    static NodeBase *sort_impl(NodeBase &head, detail::compare<T> auto &comp);
+    static NodeBase *gather_sort_impl(NodeBase &head, 
+            detail::compare<T> auto &comp);
+
+    // lists shorter than this are sorted in place even with 
+    // sort_strategy::gather, the buffer does not pay off for them
+    static constexpr size_type gather_sort_threshold = 256;
+
+    // minimal number of nodes a thread gets in the parallel sort
+    static constexpr size_type parallel_sort_grain = 1 << 14;
 
     NodeBase head_;
     NodeAlloc alloc_;
+    [[no_unique_address]] SizeCounter size_{};
+    [[no_unique_address]] TailPointer tail_{&head_};
+    [[no_unique_address]] SpareList spare_;
 };
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList() 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList() 
     : head_(nullptr), alloc_(Alloc{}) {}
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(const Alloc &alloc) 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(const Alloc &alloc) 
     : head_(nullptr), alloc_(alloc) {}
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(const ForwardList &other) 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(const ForwardList &other) 
     : ForwardList(other, 
         Traits::select_on_container_copy_construction(other.alloc_)) {}
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(const ForwardList &other,
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(const ForwardList &other,
     const Alloc &alloc) 
     : ForwardList(alloc) 
 {
     assign(other.cbegin(), other.cend());
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(ForwardList &&other) 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(ForwardList &&other) 
     : ForwardList(std::move(other), Alloc()) {}
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(ForwardList &&other, 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(ForwardList &&other, 
     const Alloc &alloc) 
-    : head_(other.head_), alloc_(alloc)
+    : head_(nullptr), alloc_(alloc)
 {
-    other.head_ = nullptr;
+    steal(other);
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(size_type count, const Alloc &alloc) 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(size_type count, const Alloc &alloc) 
     : ForwardList(alloc)
 {
     insert_empty_after(before_begin(), count);
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(size_type count, 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(size_type count, 
     const T &value, const Alloc &alloc) 
     : ForwardList(alloc)
 {
     insert_after(before_begin(), count, value);
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(
     std::input_iterator auto first, std::input_iterator auto last, 
     const Alloc &alloc) 
     : ForwardList(alloc)
@@ -219,29 +393,39 @@ ForwardList<T, Alloc>::ForwardList(
     assign(first, last);
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::ForwardList(
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::ForwardList(
     std::initializer_list<T> init, const Alloc &alloc) 
     : ForwardList(alloc)
 {
     assign(std::move_iterator(init.begin()), std::move_iterator(init.end()));
 }
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::~ForwardList() {
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::~ForwardList() {
     clear();
+    release_spare_nodes();
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+Alloc ForwardList<T, Alloc, Policy>::get_allocator() const {
+    return Alloc(alloc_);
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc> &ForwardList<T, Alloc>::operator = (
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy> &ForwardList<T, Alloc, Policy>::operator = (
         const ForwardList &other) 
 {
     if(std::addressof(*this) == std::addressof(other)) {
         return *this;
     }
 
-    clear();
-
     if(NodeTraits::propagate_on_container_copy_assignment::value) {
+        //the nodes can be reused only if they stay with their allocator
+        if(!same_allocator(other)) {
+            clear();
+            release_spare_nodes();
+        }
+
         alloc_ = other.alloc_;
     }
 
@@ -249,19 +433,20 @@ ForwardList<T, Alloc> &ForwardList<T, Alloc>::operator = (
     return *this;
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc> &ForwardList<T, Alloc>::operator = (
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy> &ForwardList<T, Alloc, Policy>::operator = (
         ForwardList &&other) 
 {
     if(NodeTraits::propagate_on_container_move_assignment::value) {
         clear();
+        if(!same_allocator(other)) {
+            release_spare_nodes();
+        }
         alloc_ = std::move(other.alloc_);
-        head_ = other.head_;
-        other.head_.setNext(nullptr);
-    } else if(NodeTraits::is_always_equal::value || alloc_ == other.alloc_) {
+        steal(other);
+    } else if(same_allocator(other)) {
         clear();
-        head_ = other.head_;
-        other.head_.setNext(nullptr);
+        steal(other);
     } else {
         assign(std::move_iterator(other.begin()), 
                std::move_iterator(other.end()));
@@ -270,85 +455,108 @@ ForwardList<T, Alloc> &ForwardList<T, Alloc>::operator = (
     return *this;
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc> &ForwardList<T, Alloc>::operator = (
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy> &ForwardList<T, Alloc, Policy>::operator = (
         std::initializer_list<T> ilist) 
 {
     assign(std::move_iterator(ilist.begin()), std::move_iterator(ilist.end()));
     return *this;
 }
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::insert_after(const_iterator pos, const T& value) {
-    pos.setNext(new_node(pos.next(), value));
-    return iterator(pos.next());
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::insert_after(const_iterator pos, const T& value) {
+    return link_after(pos, new_node(nullptr, value));
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::insert_after(const_iterator pos, T&& value) {
-    pos.setNext(new_node(pos.next(), std::move(value)));
-    return iterator(pos.next());
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::insert_after(const_iterator pos, T&& value) {
+    return link_after(pos, new_node(nullptr, std::move(value)));
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::insert_after(
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::insert_after(
         const_iterator pos, 
         size_type count, 
         const T& value)
 {
-    for(size_type i = 0; i < count; ++i) {
-        pos = insert_after(pos, value);
-    }
-    
-    return iterator(pos.node());
+    return link_chain_after(pos, new_chain(count, [this, &value](Node *node) {
+            NodeTraits::construct(alloc_, node, nullptr, value);
+        }));
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::insert_after( 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::insert_after( 
         const_iterator pos, 
         std::initializer_list<T> ilist)
 {
-    for(auto &&value: ilist) {
-        pos = insert_after(pos, std::move(value));
-    }
-
-    return iterator(pos.node());
+    return insert_after(pos, ilist.begin(), ilist.end());
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::insert_after( 
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::insert_after( 
         const_iterator pos, 
         std::input_iterator auto first, 
         std::input_iterator auto last)
 {
-    for(; first != last; ++first) {
-        pos = insert_after(pos, *first);
+    if constexpr(std::forward_iterator<decltype(first)>) {
+        auto count = static_cast<size_type>(std::distance(first, last));
+
+        return link_chain_after(pos, new_chain(count,
+                    [this, &first](Node *node) {
+                        NodeTraits::construct(alloc_, node, nullptr,
+                                *first++);
+                    }));
+    } else {
+        return link_chain_after(pos, new_chain(first, last));
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::insert_after(
+        const_iterator pos, 
+        node_type &&node) 
+{
+    if(node.empty()) {
+        return iterator(pos.node_);
     }
 
-    return iterator(pos.node());
+    if(!NodeTraits::is_always_equal::value && alloc_ != *node.alloc_) {
+        iterator it = emplace_after(pos, std::move(node.value()));
+        node.reset();
+        return it;
+    }
+
+    return link_after(pos, node.release());
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::node_type 
+ForwardList<T, Alloc, Policy>::extract_after(const_iterator pos) {
+    return node_type(unlink_next_node(pos), alloc_);
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, list_policy Policy>
 template<typename ...Args>
-ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::emplace_after(const_iterator pos, Args &&...args) {
-    pos.setNext(new_emplace_node(pos.next(), std::forward<Args>(args)...));
-    return iterator(pos.node());
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::emplace_after(const_iterator pos, Args &&...args) {
+    return link_after(pos, 
+            new_emplace_node(nullptr, std::forward<Args>(args)...));
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::clear() {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::clear() {
     erase_after(before_begin(), end());
 }
 
 
-template <typename T, typename Alloc>
-typename ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::erase_after(const_iterator pos) {
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::erase_after(const_iterator pos) {
     if(!pos.next()) {
         return iterator(pos.node());
     }
@@ -357,58 +565,190 @@ ForwardList<T, Alloc>::erase_after(const_iterator pos) {
     return iterator(std::next(pos).node());
 }
 
-template <typename T, typename Alloc>
-typename ForwardList<T, Alloc>::iterator 
-ForwardList<T, Alloc>::erase_after(const_iterator first, const_iterator last) {
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::erase_after(const_iterator first, const_iterator last) {
     if(first == last || std::next(first) == last) {
         return iterator(last.node());
     }
 
-    while(std::next(first) != last) {
-        destroy_next_node(first);
-    }
-
+    //the range is unlinked at once and then freed
+    NodeBase *chain = first.next();
+    first.setNext(last.node_);
+    unlinked(first.node_, delete_chain(chain, last.node_));
     return iterator(last.node());
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::assign(
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::assign(
         std::input_iterator auto first, 
         std::input_iterator auto last)
 {
     auto dest = before_begin();
 
-    for(auto source = first; source != last; ++source, ++dest) {
-        if(dest.next() != nullptr) {
-            dest.next()->value() = *source;
-        } else {
-            dest.setNext(new_node(nullptr, *source));
+    for(; first != last && dest.next() != nullptr; ++first, ++dest) {
+        dest.next()->value() = *first;
+    }
+
+    if(first == last) {
+        erase_after(dest, end());
+    } else {
+        insert_after(dest, first, last);
+    }
+}
+
+//builds the new chain completely before the old nodes are touched, the 
+//old nodes bypass the spare nodes so they are not handed out again. All
+//storage is allocated before the first element is moved, so a failed
+//allocation leaves every element in its old node
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::compact() {
+    size_type count = count_nodes();
+
+    if(count < 2) {
+        return;
+    }
+
+    Node *run = nullptr;
+
+    if constexpr(detail::contiguous_allocator<NodeAlloc>) {
+        run = alloc_.allocate_contiguous(count);
+    }
+
+    //without a run the storage is linked in allocation order through a
+    //NodeBase constructed at its start, as the spare nodes are
+    NodeBase storage_head;
+    NodeBase *storage_last = &storage_head;
+
+    auto release_storage = [this, &storage_head] {
+        for(NodeBase *storage = storage_head.next(); storage != nullptr;) {
+            NodeBase *next = storage->next();
+            NodeTraits::deallocate(alloc_,
+                    static_cast<Node *>(static_cast<void *>(storage)), 1);
+            storage = next;
+        }
+    };
+
+    if(run == nullptr) {
+        try {
+            for(size_type i = 0; i < count; ++i) {
+                Node *storage = NodeTraits::allocate(alloc_, 1);
+                storage_last->setNext(
+                        ::new(static_cast<void *>(storage)) NodeBase(nullptr));
+                storage_last = storage_last->next();
+            }
+        } catch(...) {
+            release_storage();
+            throw;
+        }
+    }
+
+    NodeBase head;
+    NodeBase *last = &head;
+    size_type built = 0;
+
+    try {
+        for(Node *node = head_.next(); node != nullptr; node = node->next()) {
+            Node *storage = nullptr;
+
+            if(run != nullptr) {
+                storage = run + built;
+            } else {
+                NodeBase *next = storage_head.next();
+                storage_head.setNext(next->next());
+                storage = static_cast<Node *>(static_cast<void *>(next));
+            }
+
+            try {
+                NodeTraits::construct(alloc_, storage, nullptr, 
+                        std::move_if_noexcept(node->value()));
+            } catch(...) {
+                if(run == nullptr) {
+                    NodeTraits::deallocate(alloc_, storage, 1);
+                }
+                throw;
+            }
+
+            last->setNext(storage);
+            last = storage;
+            ++built;
+        }
+    } catch(...) {
+        for(Node *node = head.next(); node != nullptr;) {
+            Node *next = node->next();
+            NodeTraits::destroy(alloc_, node);
+            NodeTraits::deallocate(alloc_, node, 1);
+            node = next;
+        }
+
+        for(size_type i = built; run != nullptr && i < count; ++i) {
+            NodeTraits::deallocate(alloc_, run + i, 1);
+        }
+
+        release_storage();
+        throw;
+    }
+
+    for(Node *node = head_.next(); node != nullptr;) {
+        Node *next = node->next();
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+        node = next;
+    }
+
+    head_.setNext(head.next());
+    relinked(last);
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+double ForwardList<T, Alloc, Policy>::fragmentation() const {
+    size_type links = 0;
+    size_type scattered = 0;
+
+    for(Node *node = head_.next(); 
+            node != nullptr && node->next() != nullptr; 
+            node = node->next(), ++links) 
+    {
+        auto from = reinterpret_cast<std::uintptr_t>(node);
+        auto to = reinterpret_cast<std::uintptr_t>(node->next());
+
+        if(to < from || to - from > fragmentation_distance) {
+            ++scattered;
         }
     }
 
-    erase_after(dest, end());
+    return links == 0 ? 0.0 : static_cast<double>(scattered) / links;
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+bool ForwardList<T, Alloc, Policy>::compact_if_fragmented(double threshold) {
+    if(fragmentation() <= threshold) {
+        return false;
+    }
+
+    compact();
+    return true;
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::push_front(const T &value) {
-    head_.setNext(new_node(head_.next(), value));
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::push_front(const T &value) {
+    insert_after(before_begin(), value);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::push_front(T &&value) {
-    head_.setNext(new_node(head_.next(), std::move(value)));
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::push_front(T &&value) {
+    insert_after(before_begin(), std::move(value));
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, list_policy Policy>
 template<typename ...Args>
-ForwardList<T, Alloc>::reference 
-ForwardList<T, Alloc>::emplace_front(Args &&...args) {
-    head_.setNext(new_emplace_node(head_.next(), std::forward<Args>(args)...));
-    return front();
+ForwardList<T, Alloc, Policy>::reference 
+ForwardList<T, Alloc, Policy>::emplace_front(Args &&...args) {
+    return *emplace_after(before_begin(), std::forward<Args>(args)...);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::resize(size_type count) {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::resize(size_type count) {
     size_type old_size = crop(count);
 
     if(old_size >= count) {
@@ -416,12 +756,16 @@ void ForwardList<T, Alloc>::resize(size_type count) {
     }
 
     auto it = before_begin();
-    std::advance(it, old_size);
+    if constexpr(tracks_tail) {
+        it = iterator(tail_);
+    } else {
+        std::advance(it, old_size);
+    }
     insert_empty_after(it, count - old_size);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::resize(size_type count, const value_type& value) {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::resize(size_type count, const value_type& value) {
     size_type old_size = crop(count);
 
     if(old_size >= count) {
@@ -429,111 +773,148 @@ void ForwardList<T, Alloc>::resize(size_type count, const value_type& value) {
     }
 
     auto it = before_begin();
-    std::advance(it, old_size);
+    if constexpr(tracks_tail) {
+        it = iterator(tail_);
+    } else {
+        std::advance(it, old_size);
+    }
     insert_after(it, count - old_size, value);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::swap(ForwardList &other) {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::swap(ForwardList &other) {
     std::swap(*this, other);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::merge(ForwardList &other) {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::merge(ForwardList &other) {
     merge(std::move(other), std::less<T>{});
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::merge(ForwardList &&other) {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::merge(ForwardList &&other) {
     merge(std::move(other), std::less<T>{});
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::merge(
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::merge(
         ForwardList &other, 
         detail::compare<T> auto comp) 
 {
     merge(std::move(other), comp);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::merge(
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::merge(
         ForwardList &&other, 
         detail::compare<T> auto comp) 
 {
-    if(addressof(*this) == addressof(other)) {
+    if(std::addressof(*this) == std::addressof(other)) {
         return;
     }
 
-    auto dst_prev = before_begin();
-    auto src_prev = other.before_begin();
-    auto dst = begin();
-    auto src = other.begin();
+    auto less = node_compare(comp);
+    NodeBase *second = other.head_.next();
 
-    for(auto last = end(); src != last && dst != last; ++dst_prev, ++dst) {
-        if(comp(*dst, *src)) {
-            splice_after(dst_prev, other, src_prev);
-            dst = std::next(dst_prev);
-            src = std::next(src_prev);
-        } 
+    if constexpr(tracks_size) {
+        size_ += other.size_;
     }
-
-    if(dst != end()) {
-        return;
+    other.reset();
+
+    //even if comp throws, all nodes of other end up in this list
+    try {
+        relinked(detail::merge_chains<NodeBase>(
+                &head_, head_.next(), second, less));
+    } catch(...) {
+        relinked();
+        throw;
     }
-
-    dst_prev.setNext(src.node());
-    src_prev.setNext(nullptr);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::splice_after(
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::splice_after(
         const_iterator pos, 
         ForwardList &other) 
 {
-    splice_after(pos, other, other.before_begin(), other.end());
+    if(other.empty()) {
+        return;
+    }
+
+    NodeBase *first = other.head_.next();
+    NodeBase *last = nullptr;
+    size_type count = 0;
+
+    if constexpr(tracks_tail) {
+        last = other.tail_;
+    } else {
+        last = detail::last_node(first);
+    }
+
+    if constexpr(tracks_size) {
+        count = other.size_;
+    }
+
+    other.reset();
+    last->setNext(pos.next());
+    pos.setNext(first);
+    linked(pos.node_, last, count);
 }
 
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::splice_after( 
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::splice_after( 
         const_iterator pos, 
         ForwardList &other, 
         const_iterator it)
 {
-    auto temp = pos.next();
-    pos.setNext(it.next());
-    it.setNext(it.next()->next());
-    pos.next()->setNext(temp);
+    Node *node = it.next();
+
+    if(pos == it || pos.node_ == node) {
+        return;
+    }
+
+    it.setNext(node->next());
+    other.unlinked(it.node_, 1);
+    node->setNext(pos.next());
+    pos.setNext(node);
+    linked(pos.node_, node, 1);
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::splice_after( 
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::splice_after( 
         const_iterator pos, 
         ForwardList& other, 
         const_iterator first, 
         const_iterator last) 
 {
-    auto temp = pos.next();
-    pos.setNext(first.next());
+    NodeBase *begin = first.next();
 
-    for(auto next = std::next(pos); next != last; ++pos, ++next);
+    if(first == last || begin == last.node_) {
+        return;
+    }
+
+    NodeBase *end = begin;
+    size_type count = 1;
+    for(; end->next() != last.node_; end = end->next(), ++count);
 
-    pos.setNext(temp);
-    first.setNext(last.node());
+    first.setNext(last.node_);
+    other.unlinked(first.node_, count);
+    end->setNext(pos.next());
+    pos.setNext(begin);
+    linked(pos.node_, end, count);
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::size_type 
-ForwardList<T, Alloc>::remove(const T& value) {
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::size_type 
+ForwardList<T, Alloc, Policy>::remove(const T& value) {
     return remove_if([&value](const T& element) {
             return element == value;
             });
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::size_type 
-ForwardList<T, Alloc>::remove_if(std::predicate<T> auto pred) {
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::size_type 
+ForwardList<T, Alloc, Policy>::remove_if(std::predicate<T> auto pred) {
     auto curr = begin();
     auto prev = before_begin();
     auto stop = end();
@@ -554,10 +935,14 @@ ForwardList<T, Alloc>::remove_if(std::predicate<T> auto pred) {
     return count;
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::reverse() {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::reverse() {
     Node *prev = nullptr;
     Node *curr = begin().node();
+
+    if(curr != nullptr) {
+        relinked(curr);
+    }
     
     while(curr != nullptr) {
         Node *temp = curr->next();
@@ -569,14 +954,14 @@ void ForwardList<T, Alloc>::reverse() {
     head_.setNext(prev);
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::size_type ForwardList<T, Alloc>::unique() {
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::size_type ForwardList<T, Alloc, Policy>::unique() {
     return unique(std::equal_to<T>{});
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::size_type 
-ForwardList<T, Alloc>::unique(detail::compare<T> auto pred) {
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::size_type 
+ForwardList<T, Alloc, Policy>::unique(detail::compare<T> auto pred) {
     if(this->empty()) {
         return 0;
     }
@@ -600,87 +985,555 @@ ForwardList<T, Alloc>::unique(detail::compare<T> auto pred) {
     return count;
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::sort() {
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::sort() {
     sort(std::less<T>{});
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::sort(detail::compare<T> auto comp) {
-    size_type size = std::distance(begin(), end());
-    sort_impl(*this, size, comp);
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::sort(detail::compare<T> auto comp) {
+    try {
+        relinked(sort_impl(head_, comp));
+    } catch(...) {
+        relinked();
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::sort(sort_strategy strategy) {
+    sort(strategy, std::less<T>{});
 }
 
-//implementation of merge sort
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::sort_impl(
-        ForwardList &list,
-        size_type size,
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::sort(
+        sort_strategy strategy, 
         detail::compare<T> auto comp) 
 {
-    if(size <= 1) {
+    try {
+        if(strategy == sort_strategy::gather) {
+            relinked(gather_sort_impl(head_, comp));
+        } else {
+            relinked(sort_impl(head_, comp));
+        }
+    } catch(...) {
+        relinked();
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::sort(parallel_policy policy) {
+    sort(policy, std::less<T>{});
+}
+
+//splits the list into one chain per thread, sorts the chains concurrently
+//and merges neighbouring chains pairwise, also concurrently, until one is left
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::sort(
+        parallel_policy policy, 
+        detail::compare<T> auto comp) 
+{
+    size_type size = count_nodes();
+    size_type chains = std::min<size_type>(
+            policy.thread_count(), size / parallel_sort_grain);
+
+    if(chains <= 1) {
+        sort(comp);
         return;
     }
 
-    size_type left_sz = size / 2;
-    size_type right_sz = size - left_sz;
-    auto pos = std::next(list.before_begin(), left_sz);
+    std::vector<NodeBase> heads(chains);
+    std::vector<NodeBase *> tails(chains);
+    NodeBase *rest = head_.next();
+
+    for(size_type i = 0; i < chains; ++i) {
+        heads[i].setNext(rest);
+        rest = detail::split_chain(rest, size / chains + (i < size % chains));
+    }
+
+    head_.setNext(nullptr);
+
+    auto sort_task = [&heads, &tails, &comp](std::size_t i) {
+        auto local_comp = comp;
+        tails[i] = sort_impl(heads[i], local_comp);
+    };
+
+    std::exception_ptr error = detail::parallel_invoke(chains, sort_task);
+
+    for(size_type step = 1; step < chains && !error; step *= 2) {
+        auto merge_task = [&heads, &tails, &comp, chains, step](
+                std::size_t i) 
+        {
+            size_type first = 2 * step * i;
+            size_type second = first + step;
+
+            if(second >= chains) {
+                return;
+            }
+
+            auto local_comp = comp;
+            auto less = node_compare(local_comp);
+            NodeBase *other = heads[second].next();
+            heads[second].setNext(nullptr);
+            tails[first] = detail::merge_chains<NodeBase>(
+                    &heads[first], heads[first].next(), other, less);
+        };
+
+        error = detail::parallel_invoke(
+                (chains + 2 * step - 1) / (2 * step), merge_task);
+    }
+
+    if(!error) {
+        head_.setNext(heads.front().next());
+        relinked(tails.front());
+        return;
+    }
+
+    //every node is still linked into one of the chains
+    NodeBase *tail = &head_;
+    for(NodeBase &chain : heads) {
+        if(chain.next() != nullptr) {
+            tail->setNext(chain.next());
+            tail = detail::last_node(tail);
+        }
+    }
+
+    relinked(tail);
+    std::rethrow_exception(error);
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::radix_sort() requires std::integral<T> {
+    radix_sort(std::identity{});
+}
+
+//signed keys are sorted as unsigned ones with the sign bit flipped
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::radix_sort(
+        detail::key_extractor<T> auto key)
+{
+    using Key = std::remove_cvref_t<std::invoke_result_t<decltype(key) &,
+          const T &>>;
+    using Bits = std::make_unsigned_t<Key>;
+
+    auto bits = [&key](NodeBase *node) {
+        auto bits = static_cast<Bits>(key(static_cast<Node *>(node)->value()));
+
+        if constexpr(std::signed_integral<Key>) {
+            bits ^= static_cast<Bits>(Bits{1} << (sizeof(Bits) * 8 - 1));
+        }
+
+        return bits;
+    };
+
+    try {
+        relinked(detail::radix_sort_chain(&head_, bits));
+    } catch(...) {
+        relinked();
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::partial_sort(size_type k) {
+    partial_sort(k, std::less<T>{});
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::partial_sort(
+        size_type k,
+        detail::compare<T> auto comp)
+{
+    try {
+        relinked(detail::partial_sort_chain(&head_, k, node_compare(comp)));
+    } catch(...) {
+        relinked();
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator
+ForwardList<T, Alloc, Policy>::nth_element(size_type n) {
+    return nth_element(n, std::less<T>{});
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator
+ForwardList<T, Alloc, Policy>::nth_element(
+        size_type n,
+        detail::compare<T> auto comp)
+{
+    try {
+        auto [nth, last] = detail::select_chain(&head_, n, node_compare(comp));
+        relinked(last);
+        return iterator(nth);
+    } catch(...) {
+        relinked();
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>
+ForwardList<T, Alloc, Policy>::split_after(const_iterator pos) {
+    ForwardList rest(get_allocator());
+    NodeBase *first = pos.next();
+
+    if(first == nullptr) {
+        return rest;
+    }
+
+    size_type count = 0;
+
+    if constexpr(tracks_size) {
+        for(NodeBase *node = first; node != nullptr; node = node->next()) {
+            ++count;
+        }
+    }
+
+    NodeBase *last = nullptr;
+
+    if constexpr(tracks_tail) {
+        last = tail_;
+    }
 
-    ForwardList right;
-    right.head_.setNext(pos.next());
     pos.setNext(nullptr);
-    sort_impl(list, left_sz, comp);
-    sort_impl(right, right_sz, comp);
-    list.merge(right, comp);
+    unlinked(pos.node_, count);
+    rest.head_.setNext(first);
+    rest.linked(&rest.head_, last, count);
+    return rest;
+}
+
+//links every node after the last node of its destination, the nodes that
+//are not distributed yet stay linked to each other
+template <typename T, typename Alloc, list_policy Policy>
+std::vector<ForwardList<T, Alloc, Policy>>
+ForwardList<T, Alloc, Policy>::partition_into(
+        size_type n,
+        detail::key_extractor<T> auto key)
+{
+    std::vector<ForwardList> lists;
+    lists.reserve(n);
+
+    for(size_type i = 0; i < n; ++i) {
+        lists.emplace_back(get_allocator());
+    }
+
+    std::vector<NodeBase *> tails(n);
+    std::vector<size_type> counts(n);
+
+    for(size_type i = 0; i < n; ++i) {
+        tails[i] = &lists[i].head_;
+    }
+
+    NodeBase *node = head_.next();
+
+    try {
+        for(; node != nullptr; node = node->next()) {
+            auto key_value = std::invoke(key,
+                    static_cast<Node *>(node)->value());
+
+            if(!std::in_range<size_type>(key_value)
+                    || static_cast<size_type>(key_value) >= n)
+            {
+                throw std::out_of_range("ForwardList::partition_into: "
+                        "key out of range");
+            }
+
+            auto index = static_cast<size_type>(key_value);
+            tails[index]->setNext(node);
+            tails[index] = node;
+            ++counts[index];
+        }
+    } catch(...) {
+        NodeBase *last = &head_;
+
+        for(size_type i = 0; i < n; ++i) {
+            if(tails[i] != &lists[i].head_) {
+                last->setNext(lists[i].head_.next());
+                last = tails[i];
+            }
+
+            lists[i].head_.setNext(nullptr);
+        }
+
+        last->setNext(node);
+        relinked();
+        throw;
+    }
+
+    for(size_type i = 0; i < n; ++i) {
+        tails[i]->setNext(nullptr);
+        lists[i].linked(&lists[i].head_, tails[i], counts[i]);
+    }
+
+    reset();
+    return lists;
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+auto ForwardList<T, Alloc, Policy>::node_compare(detail::compare<T> auto &comp) {
+    return [&comp](NodeBase *lhs, NodeBase *rhs) {
+        return comp(static_cast<Node *>(lhs)->value(), 
+                    static_cast<Node *>(rhs)->value());
+    };
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::insert_empty_after(
+//bottom-up merge sort of the nodes that follow head, 
+//returns the last sorted node
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::NodeBase *
+ForwardList<T, Alloc, Policy>::sort_impl(
+        NodeBase &head,
+        detail::compare<T> auto &comp) 
+{
+    return detail::sort_chain(&head, node_compare(comp));
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::NodeBase *
+ForwardList<T, Alloc, Policy>::gather_sort_impl(
+        NodeBase &head,
+        detail::compare<T> auto &comp) 
+{
+    size_type size = 0;
+    for(Node *node = head.next(); 
+            node != nullptr && size < gather_sort_threshold; 
+            node = node->next(), ++size);
+
+    if(size < gather_sort_threshold) {
+        return sort_impl(head, comp);
+    }
+
+    return detail::gather_sort_chain(&head, [](NodeBase *node) -> const T & {
+            return static_cast<Node *>(node)->value();
+        }, comp);
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::insert_empty_after(
         const_iterator pos, 
         size_type count) 
 {
-    for(size_type i = 0; i < count; ++i) {
-        pos.setNext(new_empty_node(pos.next()));        
+    link_chain_after(pos, new_chain(count, [this](Node *node) {
+            NodeTraits::construct(alloc_, node, nullptr);
+        }));
+}
+
+//the spare nodes are used up first, the rest comes from one run if the
+//allocator can hand out runs
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::NodeChain
+ForwardList<T, Alloc, Policy>::new_chain(size_type count, auto make) {
+    if(count == 0) {
+        return NodeChain{};
     }
+
+    size_type spares = 0;
+
+    if constexpr(recycles_nodes) {
+        spares = std::min(count, spare_.count);
+    }
+
+    Node *run = nullptr;
+
+    if constexpr(detail::contiguous_allocator<NodeAlloc>) {
+        if(count - spares > 1) {
+            run = alloc_.allocate_contiguous(count - spares);
+        }
+    }
+
+    NodeBase head;
+    NodeBase *tail = &head;
+    size_type built = 0;
+
+    try {
+        for(; built < count; ++built) {
+            bool in_run = run != nullptr && built >= spares;
+            Node *node = in_run ? run + (built - spares) : allocate_node();
+
+            try {
+                make(node);
+            } catch(...) {
+                if(!in_run) {
+                    deallocate_node(node);
+                }
+                throw;
+            }
+
+            tail->setNext(node);
+            tail = node;
+        }
+    } catch(...) {
+        tail->setNext(nullptr);
+        delete_chain(head.next(), nullptr);
+
+        for(size_type i = built > spares ? built - spares : 0;
+                run != nullptr && i < count - spares; ++i)
+        {
+            NodeTraits::deallocate(alloc_, run + i, 1);
+        }
+
+        throw;
+    }
+
+    tail->setNext(nullptr);
+    return NodeChain{head.next(), static_cast<Node *>(tail), count};
 }
 
-template <typename T, typename Alloc>
-typename ForwardList<T, Alloc>::Node *
-ForwardList<T, Alloc>::new_empty_node(NodeBase *next) {
-    Node *node = NodeTraits::allocate(alloc_, 1);
-    NodeTraits::construct(alloc_, node, next);
-    return node;
+//the number of elements is unknown, so the nodes are allocated one by one
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::NodeChain
+ForwardList<T, Alloc, Policy>::new_chain(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    NodeBase head;
+    NodeBase *tail = &head;
+    size_type count = 0;
+
+    try {
+        for(; first != last; ++first, ++count) {
+            Node *node = new_emplace_node(nullptr, *first);
+            tail->setNext(node);
+            tail = node;
+        }
+    } catch(...) {
+        delete_chain(head.next(), nullptr);
+        throw;
+    }
+
+    if(count == 0) {
+        return NodeChain{};
+    }
+
+    return NodeChain{head.next(), static_cast<Node *>(tail), count};
 }
 
-template <typename T, typename Alloc>
-typename ForwardList<T, Alloc>::Node *
-ForwardList<T, Alloc>::new_node(NodeBase *next, const T &value) {
-    Node *node = NodeTraits::allocate(alloc_, 1);
-    NodeTraits::construct(alloc_, node, next, value);
-    return node;
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator
+ForwardList<T, Alloc, Policy>::link_chain_after(
+        const_iterator pos,
+        const NodeChain &chain)
+{
+    if(chain.count == 0) {
+        return iterator(pos.node());
+    }
+
+    chain.last->setNext(pos.next());
+    pos.setNext(chain.first);
+    linked(pos.node_, chain.last, chain.count);
+    return iterator(chain.last);
 }
 
-template <typename T, typename Alloc>
-typename ForwardList<T, Alloc>::Node *
-ForwardList<T, Alloc>::new_node(NodeBase *next, T &&value) {
-    Node *node = NodeTraits::allocate(alloc_, 1);
-    NodeTraits::construct(alloc_, node, next, std::move(value));
-    return node;
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::size_type
+ForwardList<T, Alloc, Policy>::delete_chain(NodeBase *first, NodeBase *last) {
+    size_type count = 0;
+
+    while(first != last) {
+        Node *node = static_cast<Node *>(first);
+        first = node->next();
+        NodeTraits::destroy(alloc_, node);
+        deallocate_node(node);
+        ++count;
+    }
+
+    return count;
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::Node *
+ForwardList<T, Alloc, Policy>::new_node(NodeBase *next, const T &value) {
+    return new_emplace_node(next, value);
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::Node *
+ForwardList<T, Alloc, Policy>::new_node(NodeBase *next, T &&value) {
+    return new_emplace_node(next, std::move(value));
+}
+
+template <typename T, typename Alloc, list_policy Policy>
 template<typename ...Args>
-typename ForwardList<T, Alloc>::Node *
-ForwardList<T, Alloc>::new_emplace_node(NodeBase *next, Args &&...args) {
-    Node *node = NodeTraits::allocate(alloc_, 1);
-    NodeTraits::construct(alloc_, node, next, std::forward<Args>(args)...);
+typename ForwardList<T, Alloc, Policy>::Node *
+ForwardList<T, Alloc, Policy>::new_emplace_node(NodeBase *next, Args &&...args) {
+    Node *node = allocate_node();
+
+    try {
+        NodeTraits::construct(alloc_, node, next, std::forward<Args>(args)...);
+    } catch(...) {
+        deallocate_node(node);
+        throw;
+    }
+
     return node;
 }
 
-template <typename T, typename Alloc>
-ForwardList<T, Alloc>::size_type 
-ForwardList<T, Alloc>::crop(size_type count) {
-    size_type size = std::distance(begin(), end());
+//storage for one node, taken from the spare nodes if there are any
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::Node *
+ForwardList<T, Alloc, Policy>::allocate_node() {
+    if constexpr(recycles_nodes) {
+        if(spare_.first != nullptr) {
+            NodeBase *spare = spare_.first;
+            spare_.first = spare->next();
+            --spare_.count;
+            return static_cast<Node *>(static_cast<void *>(spare));
+        }
+    }
+
+    return NodeTraits::allocate(alloc_, 1);
+}
+
+//gives back the storage of a node whose value is already destroyed
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::deallocate_node(Node *node) {
+    if constexpr(recycles_nodes) {
+        spare_.first = ::new(static_cast<void *>(node)) NodeBase(spare_.first);
+        ++spare_.count;
+    } else {
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::release_spare_nodes() {
+    if constexpr(recycles_nodes) {
+        while(spare_.first != nullptr) {
+            NodeBase *spare = spare_.first;
+            spare_.first = spare->next();
+            NodeTraits::deallocate(alloc_, 
+                    static_cast<Node *>(static_cast<void *>(spare)), 1);
+        }
+
+        spare_.count = 0;
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+bool ForwardList<T, Alloc, Policy>::same_allocator(
+        const ForwardList &other) const 
+{
+    return NodeTraits::is_always_equal::value || alloc_ == other.alloc_;
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::reserve(size_type count) 
+    requires recycles_nodes 
+{
+    while(spare_.count < count) {
+        Node *node = NodeTraits::allocate(alloc_, 1);
+        deallocate_node(node);
+    }
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::size_type 
+ForwardList<T, Alloc, Policy>::crop(size_type count) {
+    size_type size = count_nodes();
 
     if(size > count) {
         auto it = before_begin();
@@ -691,38 +1544,180 @@ ForwardList<T, Alloc>::crop(size_type count) {
     return size;
 }
 
-template <typename T, typename Alloc>
-void ForwardList<T, Alloc>::destroy_next_node(const_iterator pos) {
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::iterator 
+ForwardList<T, Alloc, Policy>::link_after(const_iterator pos, Node *node) {
+    node->setNext(pos.next());
+    pos.setNext(node);
+    linked(pos.node_, node, 1);
+    return iterator(node);
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+typename ForwardList<T, Alloc, Policy>::Node *
+ForwardList<T, Alloc, Policy>::unlink_next_node(const_iterator pos) {
     Node *node = pos.next();
     pos.setNext(node->next());
+    unlinked(pos.node_, 1);
+    return node;
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::destroy_next_node(const_iterator pos) {
+    Node *node = unlink_next_node(pos);
     NodeTraits::destroy(alloc_, node);
-    NodeTraits::deallocate(alloc_, node, 1);
+    deallocate_node(node);
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+ForwardList<T, Alloc, Policy>::size_type 
+ForwardList<T, Alloc, Policy>::count_nodes() const {
+    if constexpr(tracks_size) {
+        return size_;
+    } else {
+        return std::distance(begin(), end());
+    }
+}
+
+//count nodes ending with last were linked after pos
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::linked(
+        NodeBase *pos, 
+        NodeBase *last, 
+        size_type count) 
+{
+    if constexpr(tracks_size) {
+        size_ += count;
+    }
+
+    if constexpr(tracks_tail) {
+        if(tail_ == pos) {
+            tail_ = last;
+        }
+    }
+}
+
+//count nodes were unlinked after pos
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::unlinked(NodeBase *pos, size_type count) {
+    if constexpr(tracks_size) {
+        size_ -= count;
+    }
+
+    if constexpr(tracks_tail) {
+        if(pos->next() == nullptr) {
+            tail_ = pos;
+        }
+    }
+}
+
+//the nodes were reordered and last is the new last node
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::relinked(NodeBase *last) {
+    if constexpr(tracks_tail) {
+        tail_ = last;
+    }
+}
+
+//the nodes were reordered in an unknown way
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::relinked() {
+    if constexpr(tracks_tail) {
+        tail_ = detail::last_node(&head_);
+    }
+}
+
+//takes over the nodes of other, the nodes of this list must be released
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::steal(ForwardList &other) {
+    head_.setNext(other.head_.next());
+
+    if constexpr(tracks_size) {
+        size_ = other.size_;
+    }
+
+    if constexpr(tracks_tail) {
+        tail_ = other.empty() ? &head_ : other.tail_;
+    }
+
+    other.reset();
+}
+
+//takes over the chain that starts with first, the list must be empty
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::adopt(NodeBase *first) {
+    head_.setNext(first);
+
+    if constexpr(tracks_size || tracks_tail) {
+        if(first == nullptr) {
+            return;
+        }
+
+        NodeBase *last = first;
+        size_type count = 1;
+        for(; last->next() != nullptr; last = last->next(), ++count);
+
+        linked(&head_, last, count);
+    }
+}
+
+//unlinks all nodes, returns the first and the last one
+template <typename T, typename Alloc, list_policy Policy>
+std::pair<typename ForwardList<T, Alloc, Policy>::NodeBase *, 
+          typename ForwardList<T, Alloc, Policy>::NodeBase *> 
+ForwardList<T, Alloc, Policy>::release() {
+    NodeBase *first = head_.next();
+    NodeBase *last = nullptr;
+
+    if(first != nullptr) {
+        if constexpr(tracks_tail) {
+            last = tail_;
+        } else {
+            last = detail::last_node(first);
+        }
+    }
+
+    reset();
+    return {first, last};
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void ForwardList<T, Alloc, Policy>::reset() {
+    head_.setNext(nullptr);
+
+    if constexpr(tracks_size) {
+        size_ = 0;
+    }
+
+    if constexpr(tracks_tail) {
+        tail_ = &head_;
+    }
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, list_policy Policy>
 bool operator == (
-        const ForwardList<T, Alloc> &lhs,
-        const ForwardList<T, Alloc> &rhs)
+        const ForwardList<T, Alloc, Policy> &lhs,
+        const ForwardList<T, Alloc, Policy> &rhs)
 {
-    if(addressof(lhs) == addressof(rhs)) {
+    if(std::addressof(lhs) == std::addressof(rhs)) {
         return true;
     }
 
     return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, list_policy Policy>
 bool operator != (
-        const ForwardList<T, Alloc> &lhs,
-        const ForwardList<T, Alloc> &rhs)
+        const ForwardList<T, Alloc, Policy> &lhs,
+        const ForwardList<T, Alloc, Policy> &rhs)
 {
     return !(lhs == rhs);
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, list_policy Policy>
 auto operator <=> (
-        const ForwardList<T, Alloc> &lhs,
-        const ForwardList<T, Alloc> &rhs)
+        const ForwardList<T, Alloc, Policy> &lhs,
+        const ForwardList<T, Alloc, Policy> &rhs)
 {
     return std::lexicographical_compare_three_way(
             lhs.begin(), lhs.end(), rhs.begin, rhs.end()
@@ -0,0 +1,431 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "forward_list.hpp"
+#include "forward_list_access.hpp"
+#include "forward_list_chain.hpp"
+#include "concepts.hpp"
+#include "parallel.hpp"
+
+namespace mystd {
+namespace detail {
+
+template <typename List>
+struct is_forward_list : std::false_type {};
+
+template <typename T, typename Alloc, list_policy Policy>
+struct is_forward_list<ForwardList<T, Alloc, Policy>> : std::true_type {};
+
+// a ForwardList, const or not
+template <typename List>
+concept any_forward_list = is_forward_list<std::remove_const_t<List>>::value;
+
+// a range of mutable ForwardLists of the same type
+template <typename Lists>
+concept forward_list_range = std::ranges::forward_range<Lists> &&
+    is_forward_list<std::ranges::range_value_t<Lists>>::value &&
+    std::same_as<std::ranges::range_reference_t<Lists>,
+        std::ranges::range_value_t<Lists> &>;
+
+template <forward_list_range Lists>
+using list_of = std::ranges::range_value_t<Lists>;
+
+template <forward_list_range Lists>
+using list_value_of = typename list_of<Lists>::value_type;
+
+// each thread of the parallel merge_all() merges at least that many lists
+inline constexpr std::size_t parallel_merge_min_lists = 4;
+
+// Takes the nodes out of all lists, the first node of every list goes to
+// firsts. The result list is made before that, so nothing throws later.
+template <typename List>
+List release_all(forward_list_range auto &lists,
+        std::vector<FwdListNodeBase<typename List::value_type> *> &firsts)
+{
+    auto begin = std::ranges::begin(lists);
+    auto end = std::ranges::end(lists);
+
+    if(begin == end) {
+        return List{};
+    }
+
+    List result(begin->get_allocator());
+    firsts.reserve(static_cast<std::size_t>(std::ranges::distance(lists)));
+
+    for(List &list : lists) {
+        firsts.push_back(FwdListAccess::release_first(list));
+    }
+
+    return result;
+}
+
+// a chunk of the parallel algorithms holds at least that many elements
+inline constexpr std::size_t parallel_chunk_grain = 1 << 12;
+
+// threads take that many chunks each on average, so a slow thread is
+// helped by the others
+inline constexpr std::size_t parallel_chunks_per_thread = 4;
+
+// Returns the first iterator of every chunk and the end of the list, the
+// chunks but the last one have the same length. A list that tracks its size
+// is cut into exactly that many chunks. Otherwise the single pass puts a
+// bound after every stride elements and doubles the stride, dropping every
+// other bound, whenever there are more than 2 * max_chunks of them. A single
+// chunk needs no pass.
+auto chunk_bounds(any_forward_list auto &list, std::size_t max_chunks) {
+    using Iterator = decltype(list.begin());
+
+    std::vector<Iterator> bounds;
+    auto it = list.begin();
+
+    if constexpr(requires { list.size(); }) {
+        std::size_t size = list.size();
+        std::size_t chunks = std::clamp<std::size_t>(
+                size / parallel_chunk_grain, 1, max_chunks);
+        std::size_t position = 0;
+        bounds.reserve(chunks + 1);
+
+        for(std::size_t i = 0; i < chunks; ++i) {
+            std::size_t first = size / chunks * i + std::min(i, size % chunks);
+            std::advance(it, first - position);
+            position = first;
+            bounds.push_back(it);
+        }
+    } else if(max_chunks > 1) {
+        std::size_t stride = parallel_chunk_grain;
+        bounds.push_back(it);
+
+        for(std::size_t count = 0; it != list.end(); ++it, ++count) {
+            if(count != stride * bounds.size()) {
+                continue;
+            }
+
+            bounds.push_back(it);
+
+            if(bounds.size() > 2 * max_chunks) {
+                std::vector<Iterator> kept;
+                kept.reserve(bounds.size());
+
+                for(std::size_t i = 0; i < bounds.size(); i += 2) {
+                    kept.push_back(bounds[i]);
+                }
+
+                bounds.swap(kept);
+                stride *= 2;
+            }
+        }
+    } else {
+        bounds.push_back(it);
+    }
+
+    bounds.push_back(list.end());
+    return bounds;
+}
+
+// Runs task(i, first, last) for every chunk, the threads take the chunks one
+// by one. A single chunk runs on the calling thread and its exception
+// propagates, otherwise the first exception is rethrown once all threads
+// are done.
+template <typename Iterator, typename Task>
+void run_chunks(parallel_policy policy,
+        const std::vector<Iterator> &bounds,
+        Task task)
+{
+    std::size_t chunks = bounds.size() - 1;
+    std::size_t threads = std::min<std::size_t>(policy.thread_count(), chunks);
+
+    if(threads <= 1) {
+        for(std::size_t i = 0; i < chunks; ++i) {
+            task(i, bounds[i], bounds[i + 1]);
+        }
+
+        return;
+    }
+
+    std::atomic<std::size_t> next_chunk{0};
+
+    auto worker = [&bounds, &task, &next_chunk, chunks](std::size_t) {
+        for(std::size_t i = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                i < chunks;
+                i = next_chunk.fetch_add(1, std::memory_order_relaxed))
+        {
+            task(i, bounds[i], bounds[i + 1]);
+        }
+    };
+
+    std::exception_ptr error = parallel_invoke(threads, worker);
+
+    if(error) {
+        std::rethrow_exception(error);
+    }
+}
+
+inline std::size_t max_chunks(parallel_policy policy) {
+    return policy.thread_count() > 1
+        ? policy.thread_count() * parallel_chunks_per_thread : 1;
+}
+
+} //end namespace detail
+
+// The parallel algorithms first find the bounds of chunks of equal length in
+// one pass over the list, or without it if the list tracks its size, and
+// then let the threads of the policy take the chunks one by one. Lists
+// shorter than two chunks are processed on the calling thread.
+
+// Calls f for every element, the calls for different elements may run
+// concurrently. If f throws, the first exception is rethrown after all
+// threads are done and the elements of the other chunks may have been
+// visited or not.
+void parallel_for_each(parallel_policy policy,
+        detail::any_forward_list auto &list,
+        auto f);
+
+// Reduces init and transform(element) of all elements with reduce in some
+// grouping but in the order of the list, so reduce has to be associative,
+// not commutative. The elements of every chunk are reduced on their own
+// and the results of the chunks in list order at the end.
+template <typename R>
+R transform_reduce(parallel_policy policy,
+        detail::any_forward_list auto &list,
+        R init,
+        auto reduce,
+        auto transform);
+
+// number of elements for which pred holds
+std::size_t count_if(parallel_policy policy,
+        detail::any_forward_list auto &list,
+        auto pred);
+
+// Merges the sorted lists into one by relinking their nodes. Neighbouring
+// lists are merged pairwise in rounds, so it takes O(n log k) comparisons for
+// k lists instead of the O(n k) of merging them one by one with
+// ForwardList::merge(). The merge is stable, equal
+// elements keep the order of their lists in the range. All lists are left
+// empty and their nodes must come from equal allocators. The result gets
+// the allocator of the first list. If comp throws, all elements end up in
+// the first list in an unspecified order.
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(Lists &&lists);
+
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(Lists &&lists,
+        detail::compare<detail::list_value_of<Lists>> auto comp);
+
+// Merges groups of neighbouring lists concurrently and then merges the
+// results pairwise, also concurrently. Pays off for many long lists, falls
+// back to the sequential merge if there are too few lists per thread.
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(parallel_policy policy, Lists &&lists);
+
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(parallel_policy policy, Lists &&lists,
+        detail::compare<detail::list_value_of<Lists>> auto comp);
+
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(Lists &&lists) {
+    return merge_all(lists, std::less<detail::list_value_of<Lists>>{});
+}
+
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(Lists &&lists,
+        detail::compare<detail::list_value_of<Lists>> auto comp)
+{
+    using List = detail::list_of<Lists>;
+    using T = typename List::value_type;
+    using NodeBase = detail::FwdListNodeBase<T>;
+    using Node = detail::FwdListNode<T>;
+
+    std::vector<NodeBase *> firsts;
+    List result = detail::release_all<List>(lists, firsts);
+
+    auto less = [&comp](NodeBase *lhs, NodeBase *rhs) {
+        return comp(static_cast<Node *>(lhs)->value(),
+                    static_cast<Node *>(rhs)->value());
+    };
+
+    NodeBase head;
+
+    try {
+        detail::merge_all_chains<NodeBase>(&head, firsts, less);
+    } catch(...) {
+        detail::FwdListAccess::adopt(*std::ranges::begin(lists), head.next());
+        throw;
+    }
+
+    detail::FwdListAccess::adopt(result, head.next());
+    return result;
+}
+
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(parallel_policy policy, Lists &&lists) {
+    return merge_all(policy, lists,
+            std::less<detail::list_value_of<Lists>>{});
+}
+
+template <detail::forward_list_range Lists>
+detail::list_of<Lists> merge_all(parallel_policy policy, Lists &&lists,
+        detail::compare<detail::list_value_of<Lists>> auto comp)
+{
+    using List = detail::list_of<Lists>;
+    using T = typename List::value_type;
+    using NodeBase = detail::FwdListNodeBase<T>;
+    using Node = detail::FwdListNode<T>;
+
+    std::size_t groups = std::min<std::size_t>(policy.thread_count(),
+            static_cast<std::size_t>(std::ranges::distance(lists))
+                / detail::parallel_merge_min_lists);
+
+    if(groups <= 1) {
+        return merge_all(lists, comp);
+    }
+
+    std::vector<NodeBase *> firsts;
+    List result = detail::release_all<List>(lists, firsts);
+    std::vector<NodeBase> heads(groups);
+
+    //every group takes a run of neighbouring lists, so merging the groups
+    //in their order keeps the merge stable
+    auto group_task = [&firsts, &heads, &comp, groups](std::size_t i) {
+        std::size_t size = firsts.size() / groups;
+        std::size_t extra = firsts.size() % groups;
+        auto begin = firsts.begin() + i * size + std::min(i, extra);
+        std::span<NodeBase *> group(begin, size + (i < extra));
+
+        auto local_comp = comp;
+        auto less = [&local_comp](NodeBase *lhs, NodeBase *rhs) {
+            return local_comp(static_cast<Node *>(lhs)->value(),
+                              static_cast<Node *>(rhs)->value());
+        };
+
+        detail::merge_all_chains<NodeBase>(&heads[i], group, less);
+    };
+
+    std::exception_ptr error = detail::parallel_invoke(groups, group_task);
+
+    for(std::size_t step = 1; step < groups && !error; step *= 2) {
+        auto merge_task = [&heads, &comp, groups, step](
+                std::size_t i)
+        {
+            std::size_t first = 2 * step * i;
+            std::size_t second = first + step;
+
+            if(second >= groups) {
+                return;
+            }
+
+            auto local_comp = comp;
+            auto less = [&local_comp](NodeBase *lhs, NodeBase *rhs) {
+                return local_comp(static_cast<Node *>(lhs)->value(),
+                                  static_cast<Node *>(rhs)->value());
+            };
+
+            NodeBase *other = heads[second].next();
+            heads[second].setNext(nullptr);
+            detail::merge_chains<NodeBase>(
+                    &heads[first], heads[first].next(), other, less);
+        };
+
+        error = detail::parallel_invoke(
+                (groups + 2 * step - 1) / (2 * step), merge_task);
+    }
+
+    if(!error) {
+        detail::FwdListAccess::adopt(result, heads.front().next());
+        return result;
+    }
+
+    //every node is still linked into one of the groups
+    NodeBase head;
+    NodeBase *tail = &head;
+
+    for(NodeBase &group : heads) {
+        if(group.next() != nullptr) {
+            tail->setNext(group.next());
+            tail = detail::last_node(tail);
+        }
+    }
+
+    detail::FwdListAccess::adopt(*std::ranges::begin(lists), head.next());
+    std::rethrow_exception(error);
+}
+
+void parallel_for_each(parallel_policy policy,
+        detail::any_forward_list auto &list,
+        auto f)
+{
+    auto bounds = detail::chunk_bounds(list, detail::max_chunks(policy));
+
+    detail::run_chunks(policy, bounds,
+            [&f](std::size_t, auto first, auto last) {
+                auto local_f = f;
+
+                for(; first != last; ++first) {
+                    std::invoke(local_f, *first);
+                }
+            });
+}
+
+template <typename R>
+R transform_reduce(parallel_policy policy,
+        detail::any_forward_list auto &list,
+        R init,
+        auto reduce,
+        auto transform)
+{
+    auto bounds = detail::chunk_bounds(list, detail::max_chunks(policy));
+    std::vector<std::optional<R>> results(bounds.size() - 1);
+
+    detail::run_chunks(policy, bounds,
+            [&results, &reduce, &transform](std::size_t i,
+                    auto first, auto last)
+            {
+                auto local_reduce = reduce;
+                auto local_transform = transform;
+
+                if(first == last) {
+                    return;
+                }
+
+                R result = std::invoke(local_transform, *first);
+
+                for(++first; first != last; ++first) {
+                    result = std::invoke(local_reduce, std::move(result),
+                            std::invoke(local_transform, *first));
+                }
+
+                results[i].emplace(std::move(result));
+            });
+
+    for(auto &result : results) {
+        if(result) {
+            init = std::invoke(reduce, std::move(init), std::move(*result));
+        }
+    }
+
+    return init;
+}
+
+std::size_t count_if(parallel_policy policy,
+        detail::any_forward_list auto &list,
+        auto pred)
+{
+    using T = typename std::remove_cvref_t<decltype(list)>::value_type;
+
+    return transform_reduce(policy, list, std::size_t{0}, std::plus<>{},
+            [pred](const T &value) mutable -> std::size_t {
+                return std::invoke(pred, value) ? 1 : 0;
+            });
+}
+
+} //end namespace mystd
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "forward_list.hpp"
+#include "forward_list_access.hpp"
+#include "binary_stream.hpp"
+#include "concepts.hpp"
+
+namespace mystd {
+
+// Writes an element for save() with BinaryWriter::write and reads it back
+// for load().
+//
+// struct StringCodec {
+//     void encode(const std::string &value, mystd::BinaryWriter &out) {
+//         out.write_value(value.size());
+//         out.write(value.data(), value.size());
+//     }
+//     std::string decode(mystd::BinaryReader &in) { ... }
+// };
+template <typename Codec, typename T>
+concept list_codec = requires (Codec &codec,
+        const T &value, BinaryWriter &out, BinaryReader &in)
+{
+    codec.encode(value, out);
+    { codec.decode(in) } -> std::convertible_to<T>;
+};
+
+namespace detail {
+
+// The stream starts with the magic number, the format version, the size of
+// an element or 0 if a codec wrote them, and the number of elements. The
+// numbers are written in the byte order of the machine.
+struct ListStreamFormat {
+    // "MYSTDLS1" read as a little endian number
+    static constexpr std::uint64_t magic = 0x31534c445453594dULL;
+    static constexpr std::uint32_t version = 1;
+    static constexpr std::uint32_t codec_element_size = 0;
+};
+
+// load() allocates the nodes of that many elements at once
+// if the allocator can do that
+inline constexpr std::size_t load_batch_size = 4096;
+
+template <typename T, typename Alloc, list_policy Policy>
+void save_list(BinaryWriter &out,
+        const ForwardList<T, Alloc, Policy> &list,
+        std::uint32_t element_size,
+        auto encode)
+{
+    std::uint64_t count = 0;
+
+    if constexpr(requires { list.size(); }) {
+        count = list.size();
+    } else {
+        count = static_cast<std::uint64_t>(
+                std::distance(list.begin(), list.end()));
+    }
+
+    out.write_value(ListStreamFormat::magic);
+    out.write_value(ListStreamFormat::version);
+    out.write_value(element_size);
+    out.write_value(count);
+
+    for(const T &value : list) {
+        encode(value);
+    }
+}
+
+//the new nodes form a chain of their own until all elements are read,
+//so the list stays as it was if anything throws
+template <typename T, typename Alloc, list_policy Policy>
+void load_list(BinaryReader &in,
+        ForwardList<T, Alloc, Policy> &list,
+        std::uint32_t element_size,
+        auto decode)
+{
+    using NodeBase = FwdListNodeBase<T>;
+    using Node = FwdListNode<T>;
+    using NodeAlloc = typename std::allocator_traits<Alloc>
+        ::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+    if(in.read_value<std::uint64_t>() != ListStreamFormat::magic
+            || in.read_value<std::uint32_t>() != ListStreamFormat::version
+            || in.read_value<std::uint32_t>() != element_size)
+    {
+        throw std::runtime_error("load: the input holds no list of this type");
+    }
+
+    auto count = in.read_value<std::uint64_t>();
+    NodeAlloc alloc = FwdListAccess::node_allocator(list);
+    NodeBase head;
+    NodeBase *last = &head;
+
+    try {
+        while(count > 0) {
+            auto batch = static_cast<std::size_t>(
+                    std::min<std::uint64_t>(count, load_batch_size));
+            Node *run = nullptr;
+
+            if constexpr(contiguous_allocator<NodeAlloc>) {
+                run = alloc.allocate_contiguous(batch);
+            }
+
+            for(std::size_t i = 0; i < batch; ++i) {
+                Node *node = run != nullptr 
+                    ? run + i : NodeTraits::allocate(alloc, 1);
+
+                try {
+                    NodeTraits::construct(alloc, node, nullptr, decode());
+                } catch(...) {
+                    if(run == nullptr) {
+                        NodeTraits::deallocate(alloc, node, 1);
+                    }
+
+                    for(; run != nullptr && i < batch; ++i) {
+                        NodeTraits::deallocate(alloc, run + i, 1);
+                    }
+
+                    throw;
+                }
+
+                last->setNext(node);
+                last = node;
+            }
+
+            count -= batch;
+        }
+    } catch(...) {
+        last->setNext(nullptr);
+
+        for(Node *node = head.next(); node != nullptr;) {
+            Node *next = node->next();
+            NodeTraits::destroy(alloc, node);
+            NodeTraits::deallocate(alloc, node, 1);
+            node = next;
+        }
+
+        throw;
+    }
+
+    last->setNext(nullptr);
+    list.clear();
+    FwdListAccess::adopt(list, head.next());
+}
+
+} //end namespace detail
+
+// Writes the elements of list to out as they are in memory. Throws
+// std::ios_base::failure or std::system_error if the output fails.
+template <typename T, typename Alloc, list_policy Policy>
+    requires std::is_trivially_copyable_v<T>
+void save(BinaryWriter &out, const ForwardList<T, Alloc, Policy> &list) {
+    detail::save_list(out, list, sizeof(T), [&out](const T &value) {
+            out.write_value(value);
+        });
+}
+
+// writes every element of list through codec
+template <typename T, typename Alloc, list_policy Policy>
+void save(BinaryWriter &out,
+        const ForwardList<T, Alloc, Policy> &list,
+        list_codec<T> auto codec)
+{
+    detail::save_list(out, list, detail::ListStreamFormat::codec_element_size,
+            [&out, &codec](const T &value) {
+                codec.encode(value, out);
+            });
+}
+
+// saves and flushes, codec is passed on to the overloads above
+template <typename T, typename Alloc, list_policy Policy, typename ...Codec>
+void save(std::ostream &out,
+        const ForwardList<T, Alloc, Policy> &list,
+        Codec ...codec)
+{
+    BinaryWriter writer(out);
+    save(writer, list, codec...);
+    writer.flush();
+}
+
+template <typename T, typename Alloc, list_policy Policy, typename ...Codec>
+void save(int fd, const ForwardList<T, Alloc, Policy> &list, Codec ...codec) {
+    BinaryWriter writer(fd);
+    save(writer, list, codec...);
+    writer.flush();
+}
+
+// Replaces the elements of list with the ones a save() without codec
+// wrote. Throws std::runtime_error if the input is no such list or ends
+// early, the list is unchanged then.
+template <typename T, typename Alloc, list_policy Policy>
+    requires std::is_trivially_copyable_v<T>
+void load(BinaryReader &in, ForwardList<T, Alloc, Policy> &list) {
+    detail::load_list(in, list, sizeof(T), [&in]() {
+            return in.read_value<T>();
+        });
+}
+
+template <typename T, typename Alloc, list_policy Policy>
+void load(BinaryReader &in,
+        ForwardList<T, Alloc, Policy> &list,
+        list_codec<T> auto codec)
+{
+    detail::load_list(in, list, detail::ListStreamFormat::codec_element_size,
+            [&in, &codec]() {
+                return T(codec.decode(in));
+            });
+}
+
+// reads exactly the bytes the matching save() wrote
+template <typename T, typename Alloc, list_policy Policy, typename ...Codec>
+void load(std::istream &in,
+        ForwardList<T, Alloc, Policy> &list,
+        Codec ...codec)
+{
+    BinaryReader reader(in);
+    load(reader, list, codec...);
+}
+
+template <typename T, typename Alloc, list_policy Policy, typename ...Codec>
+void load(int fd, ForwardList<T, Alloc, Policy> &list, Codec ...codec) {
+    BinaryReader reader(fd);
+    load(reader, list, codec...);
+}
+
+} //end namespace mystd
@@ -0,0 +1,435 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+
+#include "intrusive_forward_list_hook.hpp"
+#include "intrusive_forward_list_iterator.hpp"
+#include "forward_list_chain.hpp"
+#include "concepts.hpp"
+#include "sort_strategy.hpp"
+
+namespace mystd {
+
+// Singly linked list of elements that embed an IntrusiveForwardListHook.
+// The list never allocates, copies or destroys elements, it only relinks
+// their hooks, so the elements must outlive their membership in the list.
+// An element can be in one list per hook at a time. The interface matches
+// ForwardList except that insertion takes the element itself.
+template <typename T, IntrusiveForwardListHook T::*Hook>
+class IntrusiveForwardList {
+    using NodeBase = IntrusiveForwardListHook;
+
+public:
+    using value_type = T;
+
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    using pointer = value_type *;
+    using const_pointer = const value_type *;
+
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using iterator = detail::IntrusiveFwdListIterator<false, T, Hook>;
+    using const_iterator = detail::IntrusiveFwdListIterator<true, T, Hook>;
+
+    IntrusiveForwardList() : head_(nullptr) {}
+
+    IntrusiveForwardList(std::input_iterator auto first,
+            std::input_iterator auto last);
+
+    IntrusiveForwardList(const IntrusiveForwardList &other) = delete;
+
+    IntrusiveForwardList(IntrusiveForwardList &&other);
+
+    IntrusiveForwardList &operator = (const IntrusiveForwardList &) = delete;
+    IntrusiveForwardList &operator = (IntrusiveForwardList &&other);
+
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+
+    iterator before_begin() { return iterator(&head_); }
+    iterator begin() { return iterator(head_.next()); }
+    iterator end() { return iterator(nullptr); }
+
+    const_iterator before_begin() const { return cbefore_begin(); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+    const_iterator cbefore_begin() const {
+        return const_iterator(const_cast<NodeBase *>(&head_));
+    }
+    const_iterator cbegin() const { return const_iterator(head_.next()); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+
+    // iterator to an element that is in the list
+    iterator iterator_to(reference value) {
+        return iterator(&(value.*Hook));
+    }
+    const_iterator iterator_to(const_reference value) const {
+        return const_iterator(const_cast<NodeBase *>(&(value.*Hook)));
+    }
+
+    bool empty() const { return head_.next() == nullptr; }
+    size_type max_size() const {
+        return std::numeric_limits<difference_type>::max();
+    }
+
+    iterator insert_after(const_iterator pos, reference value);
+    iterator insert_after(const_iterator pos,
+            std::input_iterator auto first,
+            std::input_iterator auto last);
+
+    // unlinks every element, the elements themselves are untouched
+    void clear() { head_.setNext(nullptr); }
+
+    iterator erase_after(const_iterator pos);
+    iterator erase_after(const_iterator first, const_iterator last);
+
+    void push_front(reference value);
+    void pop_front() { erase_after(before_begin()); }
+
+    void swap(IntrusiveForwardList &other);
+
+    void merge(IntrusiveForwardList &other);
+    void merge(IntrusiveForwardList &&other);
+    void merge(IntrusiveForwardList &other, detail::compare<T> auto comp);
+    void merge(IntrusiveForwardList &&other, detail::compare<T> auto comp);
+
+    void splice_after(const_iterator pos, IntrusiveForwardList &other);
+
+    void splice_after(const_iterator pos, IntrusiveForwardList &other,
+            const_iterator it);
+
+    void splice_after(const_iterator pos, IntrusiveForwardList &other,
+            const_iterator first, const_iterator last);
+
+    size_type remove(const T &value);
+    size_type remove_if(std::predicate<T> auto pred);
+
+    void reverse();
+
+    size_type unique();
+    size_type unique(detail::compare<T> auto pred);
+
+    void sort();
+    void sort(detail::compare<T> auto comp);
+    void sort(sort_strategy strategy);
+    void sort(sort_strategy strategy, detail::compare<T> auto comp);
+
+private:
+    static T &value(NodeBase *node) {
+        return *detail::hook_owner<T, Hook>(node);
+    }
+
+    static auto node_compare(detail::compare<T> auto &comp);
+
+    NodeBase head_;
+};
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::IntrusiveForwardList(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+    : IntrusiveForwardList()
+{
+    insert_after(before_begin(), first, last);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::IntrusiveForwardList(
+        IntrusiveForwardList &&other)
+    : head_(other.head_.next())
+{
+    other.head_.setNext(nullptr);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook> &
+IntrusiveForwardList<T, Hook>::operator = (IntrusiveForwardList &&other) {
+    head_.setNext(other.head_.next());
+
+    if(std::addressof(*this) != std::addressof(other)) {
+        other.head_.setNext(nullptr);
+    }
+
+    return *this;
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::iterator
+IntrusiveForwardList<T, Hook>::insert_after(
+        const_iterator pos,
+        reference value)
+{
+    NodeBase *node = &(value.*Hook);
+    node->setNext(pos.next());
+    pos.setNext(node);
+    return iterator(node);
+}
+
+//first and last iterate over references to the elements
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::iterator
+IntrusiveForwardList<T, Hook>::insert_after(
+        const_iterator pos,
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    for(; first != last; ++first) {
+        pos = insert_after(pos, *first);
+    }
+
+    return iterator(pos.node_);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::iterator
+IntrusiveForwardList<T, Hook>::erase_after(const_iterator pos) {
+    NodeBase *node = pos.next();
+
+    if(node == nullptr) {
+        return end();
+    }
+
+    pos.setNext(node->next());
+    node->setNext(nullptr);
+    return iterator(pos.next());
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::iterator
+IntrusiveForwardList<T, Hook>::erase_after(
+        const_iterator first,
+        const_iterator last)
+{
+    if(first != last) {
+        first.setNext(last.node_);
+    }
+
+    return iterator(last.node_);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::push_front(reference value) {
+    insert_after(before_begin(), value);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::swap(IntrusiveForwardList &other) {
+    NodeBase *head = head_.next();
+    head_.setNext(other.head_.next());
+    other.head_.setNext(head);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::merge(IntrusiveForwardList &other) {
+    merge(std::move(other), std::less<T>{});
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::merge(IntrusiveForwardList &&other) {
+    merge(std::move(other), std::less<T>{});
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::merge(
+        IntrusiveForwardList &other,
+        detail::compare<T> auto comp)
+{
+    merge(std::move(other), comp);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::merge(
+        IntrusiveForwardList &&other,
+        detail::compare<T> auto comp)
+{
+    if(std::addressof(*this) == std::addressof(other)) {
+        return;
+    }
+
+    auto less = node_compare(comp);
+    NodeBase *second = other.head_.next();
+    other.head_.setNext(nullptr);
+
+    //even if comp throws, all nodes of other end up in this list
+    detail::merge_chains<NodeBase>(&head_, head_.next(), second, less);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::splice_after(
+        const_iterator pos,
+        IntrusiveForwardList &other)
+{
+    if(other.empty()) {
+        return;
+    }
+
+    NodeBase *last = detail::last_node(&other.head_);
+    last->setNext(pos.next());
+    pos.setNext(other.head_.next());
+    other.head_.setNext(nullptr);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::splice_after(
+        const_iterator pos,
+        IntrusiveForwardList &,
+        const_iterator it)
+{
+    NodeBase *node = it.next();
+
+    if(pos == it || pos.node_ == node) {
+        return;
+    }
+
+    it.setNext(node->next());
+    node->setNext(pos.next());
+    pos.setNext(node);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::splice_after(
+        const_iterator pos,
+        IntrusiveForwardList &,
+        const_iterator first,
+        const_iterator last)
+{
+    if(first == last || first.next() == last.node_) {
+        return;
+    }
+
+    NodeBase *tail = first.next();
+    while(tail->next() != last.node_) {
+        tail = tail->next();
+    }
+
+    tail->setNext(pos.next());
+    pos.setNext(first.next());
+    first.setNext(last.node_);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::size_type
+IntrusiveForwardList<T, Hook>::remove(const T &value) {
+    return remove_if([&value](const T &element) {
+            return element == value;
+            });
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::size_type
+IntrusiveForwardList<T, Hook>::remove_if(std::predicate<T> auto pred) {
+    NodeBase *prev = &head_;
+    size_type count = 0;
+
+    while(NodeBase *curr = prev->next()) {
+        if(pred(value(curr))) {
+            prev->setNext(curr->next());
+            curr->setNext(nullptr);
+            ++count;
+        } else {
+            prev = curr;
+        }
+    }
+
+    return count;
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::reverse() {
+    NodeBase *prev = nullptr;
+    NodeBase *curr = head_.next();
+
+    while(curr != nullptr) {
+        NodeBase *temp = curr->next();
+        curr->setNext(prev);
+        prev = curr;
+        curr = temp;
+    }
+
+    head_.setNext(prev);
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::size_type
+IntrusiveForwardList<T, Hook>::unique() {
+    return unique(std::equal_to<T>{});
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+IntrusiveForwardList<T, Hook>::size_type
+IntrusiveForwardList<T, Hook>::unique(detail::compare<T> auto pred) {
+    NodeBase *prev = head_.next();
+    size_type count = 0;
+
+    if(prev == nullptr) {
+        return 0;
+    }
+
+    while(NodeBase *curr = prev->next()) {
+        if(pred(value(prev), value(curr))) {
+            prev->setNext(curr->next());
+            curr->setNext(nullptr);
+            ++count;
+        } else {
+            prev = curr;
+        }
+    }
+
+    return count;
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::sort() {
+    sort(std::less<T>{});
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::sort(detail::compare<T> auto comp) {
+    detail::sort_chain(&head_, node_compare(comp));
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::sort(sort_strategy strategy) {
+    sort(strategy, std::less<T>{});
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+void IntrusiveForwardList<T, Hook>::sort(
+        sort_strategy strategy,
+        detail::compare<T> auto comp)
+{
+    if(strategy == sort_strategy::gather) {
+        detail::gather_sort_chain(&head_, [](NodeBase *node) -> const T & {
+                return value(node);
+            }, comp);
+    } else {
+        sort(comp);
+    }
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+auto IntrusiveForwardList<T, Hook>::node_compare(
+        detail::compare<T> auto &comp)
+{
+    return [&comp](NodeBase *lhs, NodeBase *rhs) {
+        return comp(value(lhs), value(rhs));
+    };
+}
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+bool operator == (
+        const IntrusiveForwardList<T, Hook> &lhs,
+        const IntrusiveForwardList<T, Hook> &rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+} //end namespace mystd
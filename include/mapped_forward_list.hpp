@@ -0,0 +1,396 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mapped_forward_list_node.hpp"
+#include "mapped_forward_list_iterator.hpp"
+#include "concepts.hpp"
+
+namespace mystd {
+
+// Singly linked list that lives in a memory-mapped file, POSIX only. The
+// nodes link each other by their offset in the file, so reopening the file
+// gives back the list at once, without reading the elements. Every change
+// goes straight to the mapping, flush() waits until it reaches the disk.
+// A crash in the middle of a change may leave the file inconsistent.
+//
+// The elements are stored as they are, so T must be trivially copyable.
+// Growing the file may move the mapping, which invalidates the references
+// to the elements but not the iterators. The iterators refer to the list
+// object, so they don't survive a move of the list.
+//
+// mystd::MappedForwardList<Record> list("records.list");
+template <typename T>
+class MappedForwardList {
+    static_assert(std::is_trivially_copyable_v<T>,
+            "the elements are stored in the file byte by byte");
+
+    using Arena = detail::MappedFwdListArena<T>;
+    using Node = typename Arena::Node;
+
+    static constexpr detail::mapped_offset null_offset = detail::null_offset;
+    static constexpr detail::mapped_offset before_first =
+        detail::before_first_offset;
+
+public:
+    using value_type = T;
+
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    using pointer = value_type *;
+    using const_pointer = const value_type *;
+
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using iterator = detail::MappedFwdListIterator<false, T>;
+    using const_iterator = detail::MappedFwdListIterator<true, T>;
+
+    // opens the list in the file at path, creates the file if there is
+    // none. Throws std::system_error if the file can't be opened or mapped
+    // and std::runtime_error if it holds something else
+    explicit MappedForwardList(const std::filesystem::path &path)
+        : arena_(path) {}
+
+    MappedForwardList(MappedForwardList &&other) = default;
+    MappedForwardList &operator = (MappedForwardList &&other) = default;
+
+    MappedForwardList &operator = (std::initializer_list<T> ilist);
+
+    reference front() { return arena_.node(arena_.header().head).value; }
+    const_reference front() const {
+        return arena_.node(arena_.header().head).value;
+    }
+
+    iterator before_begin() { return iterator(&arena_, before_first); }
+    iterator begin() { return iterator(&arena_, arena_.header().head); }
+    iterator end() { return iterator(&arena_, null_offset); }
+
+    const_iterator before_begin() const { return cbefore_begin(); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+    const_iterator cbefore_begin() const {
+        return const_iterator(const_cast<Arena *>(&arena_), before_first);
+    }
+    const_iterator cbegin() const {
+        return const_iterator(const_cast<Arena *>(&arena_),
+                arena_.header().head);
+    }
+    const_iterator cend() const {
+        return const_iterator(const_cast<Arena *>(&arena_), null_offset);
+    }
+
+    bool empty() const { return arena_.header().head == null_offset; }
+    size_type size() const { return arena_.header().size; }
+
+    // number of nodes the file holds without growing
+    size_type capacity() const { return arena_.capacity(); }
+    void reserve(size_type count) { arena_.reserve(count); }
+
+    void flush() { arena_.flush(); }
+
+    iterator insert_after(const_iterator pos, const T& value);
+    iterator insert_after(const_iterator pos, size_type count, const T& value);
+    iterator insert_after(const_iterator pos, std::initializer_list<T> ilist);
+    iterator insert_after(const_iterator pos,
+            std::input_iterator auto first,
+            std::input_iterator auto last);
+
+    template<typename ...Args>
+    iterator emplace_after(const_iterator pos, Args &&...args);
+
+    // keeps the size of the file
+    void clear() { arena_.reset(); }
+
+    iterator erase_after(const_iterator pos);
+    iterator erase_after(const_iterator first, const_iterator last);
+
+    void push_front(const T &value);
+
+    template<class... Args>
+    reference emplace_front(Args &&...args);
+
+    void pop_front() { erase_after(before_begin()); };
+
+    size_type remove(const T& value);
+    size_type remove_if(std::predicate<T> auto pred);
+
+    void reverse();
+
+    size_type unique();
+    size_type unique(detail::compare<T> auto pred);
+
+    void sort();
+    void sort(detail::compare<T> auto comp);
+
+    void assign(std::input_iterator auto first, std::input_iterator auto last);
+
+private:
+    Arena arena_;
+};
+
+template <typename T>
+MappedForwardList<T> &
+MappedForwardList<T>::operator = (std::initializer_list<T> ilist) {
+    assign(ilist.begin(), ilist.end());
+    return *this;
+}
+
+template <typename T>
+MappedForwardList<T>::iterator
+MappedForwardList<T>::insert_after(const_iterator pos, const T& value) {
+    return emplace_after(pos, value);
+}
+
+template <typename T>
+MappedForwardList<T>::iterator
+MappedForwardList<T>::insert_after(
+        const_iterator pos,
+        size_type count,
+        const T& value)
+{
+    iterator it(pos.arena_, pos.offset_);
+
+    for(size_type i = 0; i < count; ++i) {
+        it = emplace_after(it, value);
+    }
+
+    return it;
+}
+
+template <typename T>
+MappedForwardList<T>::iterator
+MappedForwardList<T>::insert_after(
+        const_iterator pos,
+        std::initializer_list<T> ilist)
+{
+    return insert_after(pos, ilist.begin(), ilist.end());
+}
+
+template <typename T>
+MappedForwardList<T>::iterator
+MappedForwardList<T>::insert_after(
+        const_iterator pos,
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    iterator it(pos.arena_, pos.offset_);
+
+    for(; first != last; ++first) {
+        it = emplace_after(it, *first);
+    }
+
+    return it;
+}
+
+//the element is built before the allocation, which may move the mapping
+//with an element the arguments refer to
+template <typename T>
+template<typename ...Args>
+MappedForwardList<T>::iterator
+MappedForwardList<T>::emplace_after(const_iterator pos, Args &&...args) {
+    T value(std::forward<Args>(args)...);
+    detail::mapped_offset offset = arena_.allocate();
+
+    std::construct_at(&arena_.node(offset), pos.next(), value);
+    arena_.setNext(pos.offset_, offset);
+    ++arena_.header().size;
+    return iterator(&arena_, offset);
+}
+
+template <typename T>
+MappedForwardList<T>::iterator
+MappedForwardList<T>::erase_after(const_iterator pos) {
+    detail::mapped_offset offset = pos.next();
+    arena_.setNext(pos.offset_, arena_.node(offset).next);
+    arena_.deallocate(offset);
+    --arena_.header().size;
+    return iterator(&arena_, pos.next());
+}
+
+template <typename T>
+MappedForwardList<T>::iterator
+MappedForwardList<T>::erase_after(
+        const_iterator first,
+        const_iterator last)
+{
+    while(first.next() != last.offset_) {
+        erase_after(first);
+    }
+
+    return iterator(last.arena_, last.offset_);
+}
+
+template <typename T>
+void MappedForwardList<T>::push_front(const T &value) {
+    emplace_after(before_begin(), value);
+}
+
+template <typename T>
+template<typename ...Args>
+MappedForwardList<T>::reference
+MappedForwardList<T>::emplace_front(Args &&...args) {
+    return *emplace_after(before_begin(), std::forward<Args>(args)...);
+}
+
+template <typename T>
+MappedForwardList<T>::size_type
+MappedForwardList<T>::remove(const T& value) {
+    return remove_if([&value](const T& element) {
+            return element == value;
+            });
+}
+
+template <typename T>
+MappedForwardList<T>::size_type
+MappedForwardList<T>::remove_if(std::predicate<T> auto pred) {
+    size_type count = 0;
+    iterator prev = before_begin();
+
+    for(auto curr = prev.next(); curr != null_offset; curr = prev.next()) {
+        if(pred(arena_.node(curr).value)) {
+            erase_after(prev);
+            ++count;
+        } else {
+            ++prev;
+        }
+    }
+
+    return count;
+}
+
+template <typename T>
+void MappedForwardList<T>::reverse() {
+    detail::mapped_offset prev = null_offset;
+    detail::mapped_offset curr = arena_.header().head;
+
+    while(curr != null_offset) {
+        detail::mapped_offset next = arena_.node(curr).next;
+        arena_.node(curr).next = prev;
+        prev = curr;
+        curr = next;
+    }
+
+    arena_.header().head = prev;
+}
+
+template <typename T>
+MappedForwardList<T>::size_type MappedForwardList<T>::unique() {
+    return unique(std::equal_to<T>{});
+}
+
+template <typename T>
+MappedForwardList<T>::size_type
+MappedForwardList<T>::unique(detail::compare<T> auto pred) {
+    if(empty()) {
+        return 0;
+    }
+
+    size_type count = 0;
+    iterator prev = begin();
+
+    for(auto curr = prev.next(); curr != null_offset; curr = prev.next()) {
+        if(pred(*prev, arena_.node(curr).value)) {
+            erase_after(prev);
+            ++count;
+        } else {
+            ++prev;
+        }
+    }
+
+    return count;
+}
+
+template <typename T>
+void MappedForwardList<T>::sort() {
+    sort(std::less<T>{});
+}
+
+//sorts the offsets of the nodes and relinks them in that order,
+//the elements stay where they are
+template <typename T>
+void MappedForwardList<T>::sort(detail::compare<T> auto comp) {
+    std::vector<detail::mapped_offset> order;
+    order.reserve(size());
+
+    for(auto offset = arena_.header().head; offset != null_offset;
+            offset = arena_.node(offset).next)
+    {
+        order.push_back(offset);
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+            [this, &comp](detail::mapped_offset lhs,
+                detail::mapped_offset rhs) {
+                return comp(arena_.node(lhs).value, arena_.node(rhs).value);
+            });
+
+    detail::mapped_offset prev = before_first;
+
+    for(detail::mapped_offset offset : order) {
+        arena_.setNext(prev, offset);
+        prev = offset;
+    }
+
+    arena_.setNext(prev, null_offset);
+}
+
+template <typename T>
+void MappedForwardList<T>::assign(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    iterator dest = before_begin();
+
+    for(; first != last && std::next(dest) != end(); ++first, ++dest) {
+        *std::next(dest) = *first;
+    }
+
+    if(first == last) {
+        erase_after(dest, end());
+    } else {
+        insert_after(dest, first, last);
+    }
+}
+
+template <typename T>
+bool operator == (
+        const MappedForwardList<T> &lhs,
+        const MappedForwardList<T> &rhs)
+{
+    if(std::addressof(lhs) == std::addressof(rhs)) {
+        return true;
+    }
+
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T>
+bool operator != (
+        const MappedForwardList<T> &lhs,
+        const MappedForwardList<T> &rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename T>
+auto operator <=> (
+        const MappedForwardList<T> &lhs,
+        const MappedForwardList<T> &rhs)
+{
+    return std::lexicographical_compare_three_way(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end()
+        );
+}
+
+} //end namespace mystd
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include "forward_list.hpp"
+#include "forward_list_access.hpp"
+#include "forward_list_node.hpp"
+
+namespace mystd {
+
+// Multi-producer single-consumer FIFO queue of ForwardList nodes (Vyukov's
+// intrusive MPSC queue). A push is one atomic exchange and never waits for
+// other producers. Only one thread may consume at a time. A producer links
+// a node only to its predecessor, which the consumer does not give away
+// before that link is set, so nodes are freed without any reclamation
+// scheme. Drained nodes become a ForwardList without being copied.
+template <typename T, typename Allocator = std::allocator<T>>
+class MpscQueue {
+    using NodeBase = detail::FwdListNodeBase<T>;
+    using Node = detail::FwdListNode<T>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    using size_type = Traits::size_type;
+
+    MpscQueue() : MpscQueue(Allocator{}) {}
+
+    explicit MpscQueue(const Allocator &alloc) : alloc_(alloc) {}
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator = (const MpscQueue &) = delete;
+
+    ~MpscQueue();
+
+    Allocator get_allocator() const { return Allocator(alloc_); }
+
+    // producer side, any number of threads
+
+    void push(const T &value);
+    void push(T &&value);
+
+    template<typename ...Args>
+    void emplace(Args &&...args);
+
+    // appends all nodes of list in one step, keeping their order
+    template <list_policy Policy>
+    void push_chain(ForwardList<T, Allocator, Policy> &&list);
+
+    // consumer side, one thread at a time
+
+    // an element that is still being pushed may not be seen yet
+    bool empty() const;
+
+    // moving out of the node cannot fail, so no element is ever lost;
+    // drain() hands out elements whose move may throw
+    std::optional<T> pop() requires std::is_nothrow_move_constructible_v<T>;
+
+    // unlinks up to max_count of the available elements
+    // and returns them in queue order
+    ForwardList<T, Allocator> drain(
+            size_type max_count = std::numeric_limits<size_type>::max());
+
+private:
+    void push_chain(NodeBase *first, NodeBase *last);
+    Node *pop_node();
+
+    // producers exchange the last node, the consumer owns the first one
+    alignas(64) std::atomic<NodeBase *> last_{&stub_};
+    alignas(64) NodeBase *first_ = &stub_;
+    // stays in the queue while it is empty, so last_ is never null
+    NodeBase stub_;
+    NodeAlloc alloc_;
+};
+
+template <typename T, typename Alloc>
+MpscQueue<T, Alloc>::~MpscQueue() {
+    while(Node *node = pop_node()) {
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+}
+
+template <typename T, typename Alloc>
+void MpscQueue<T, Alloc>::push(const T &value) {
+    emplace(value);
+}
+
+template <typename T, typename Alloc>
+void MpscQueue<T, Alloc>::push(T &&value) {
+    emplace(std::move(value));
+}
+
+template <typename T, typename Alloc>
+template<typename ...Args>
+void MpscQueue<T, Alloc>::emplace(Args &&...args) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+
+    try {
+        NodeTraits::construct(alloc_, node, nullptr,
+                std::forward<Args>(args)...);
+    } catch(...) {
+        NodeTraits::deallocate(alloc_, node, 1);
+        throw;
+    }
+
+    push_chain(node, node);
+}
+
+template <typename T, typename Alloc>
+template <list_policy Policy>
+void MpscQueue<T, Alloc>::push_chain(ForwardList<T, Alloc, Policy> &&list) {
+    if(!NodeTraits::is_always_equal::value
+            && alloc_ != detail::FwdListAccess::node_allocator(list))
+    {
+        ForwardList<T, Alloc> copy(std::move_iterator(list.begin()),
+                std::move_iterator(list.end()), get_allocator());
+        list.clear();
+        push_chain(std::move(copy));
+        return;
+    }
+
+    auto [first, last] = detail::FwdListAccess::release(list);
+
+    if(first != nullptr) {
+        push_chain(first, last);
+    }
+}
+
+template <typename T, typename Alloc>
+bool MpscQueue<T, Alloc>::empty() const {
+    return first_ == &stub_
+        && stub_.loadNext(std::memory_order_acquire) == nullptr;
+}
+
+template <typename T, typename Alloc>
+std::optional<T> MpscQueue<T, Alloc>::pop()
+        requires std::is_nothrow_move_constructible_v<T> {
+    Node *node = pop_node();
+
+    if(node == nullptr) {
+        return std::nullopt;
+    }
+
+    std::optional<T> value(std::move(node->value()));
+
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+    return value;
+}
+
+template <typename T, typename Alloc>
+ForwardList<T, Alloc> MpscQueue<T, Alloc>::drain(size_type max_count) {
+    NodeBase head;
+    NodeBase *last = &head;
+
+    for(size_type count = 0; count < max_count; ++count) {
+        Node *node = pop_node();
+
+        if(node == nullptr) {
+            break;
+        }
+
+        last->setNext(node);
+        last = node;
+    }
+
+    last->setNext(nullptr);
+
+    ForwardList<T, Alloc> list(get_allocator());
+    detail::FwdListAccess::adopt(list, head.next());
+    return list;
+}
+
+//the chain is linked after the previous last node, which is the only
+//node a producer writes to after the exchange
+template <typename T, typename Alloc>
+void MpscQueue<T, Alloc>::push_chain(NodeBase *first, NodeBase *last) {
+    last->setNext(nullptr);
+    NodeBase *prev = last_.exchange(last, std::memory_order_acq_rel);
+    prev->storeNext(first, std::memory_order_release);
+}
+
+//returns a node only when its successor is linked, so no producer
+//writes to it any more
+template <typename T, typename Alloc>
+typename MpscQueue<T, Alloc>::Node *MpscQueue<T, Alloc>::pop_node() {
+    NodeBase *first = first_;
+    NodeBase *next = first->loadNext(std::memory_order_acquire);
+
+    if(first == &stub_) {
+        if(next == nullptr) {
+            return nullptr;
+        }
+
+        first_ = first = next;
+        next = next->loadNext(std::memory_order_acquire);
+    }
+
+    if(next != nullptr) {
+        first_ = next;
+        return static_cast<Node *>(first);
+    }
+
+    //first is the last node, or a producer has exchanged it
+    //but not linked its successor yet
+    if(first != last_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    push_chain(&stub_, &stub_);
+    next = first->loadNext(std::memory_order_acquire);
+
+    if(next != nullptr) {
+        first_ = next;
+        return static_cast<Node *>(first);
+    }
+
+    return nullptr;
+}
+
+} //end namespace mystd
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "node_pool.hpp"
+
+namespace mystd {
+
+// Allocator for node based containers. Single-object allocations are served
+// from a process-wide pool of fixed-size slabs shared by all allocators with
+// the same value_type size and alignment, so the instances are stateless and
+// always compare equal. With ThreadCache enabled every thread keeps a small
+// private free list and only touches the shared pool once per batch.
+//
+// mystd::ForwardList<int, mystd::NodePoolAllocator<int>> list;
+template <typename T, bool ThreadCache = true>
+class NodePoolAllocator {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind {
+        using other = NodePoolAllocator<U, ThreadCache>;
+    };
+
+    NodePoolAllocator() noexcept = default;
+
+    template <typename U>
+    NodePoolAllocator(const NodePoolAllocator<U, ThreadCache> &) noexcept {}
+
+    T *allocate(size_type n);
+    void deallocate(T *ptr, size_type n) noexcept;
+
+    // n objects adjacent in memory, each of them is released on its own
+    // with deallocate(ptr, 1)
+    T *allocate_contiguous(size_type n)
+        requires (detail::NodePool<sizeof(T), alignof(T)>::block_size 
+                == sizeof(T))
+    {
+        return static_cast<T *>(pool().allocate_run(n));
+    }
+
+    template <typename U>
+    bool operator == (const NodePoolAllocator<U, ThreadCache> &) const {
+        return true;
+    }
+
+private:
+    // T is only required to be complete once memory is requested
+    static auto &pool() {
+        return detail::NodePool<sizeof(T), alignof(T)>::instance();
+    }
+};
+
+template <typename T, bool ThreadCache>
+T *NodePoolAllocator<T, ThreadCache>::allocate(size_type n) {
+    if(n != 1) {
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    if constexpr(ThreadCache) {
+        return static_cast<T *>(pool().cached_allocate());
+    } else {
+        return static_cast<T *>(pool().allocate());
+    }
+}
+
+template <typename T, bool ThreadCache>
+void NodePoolAllocator<T, ThreadCache>::deallocate(
+        T *ptr,
+        size_type n) noexcept
+{
+    if(n != 1) {
+        std::allocator<T>{}.deallocate(ptr, n);
+        return;
+    }
+
+    if constexpr(ThreadCache) {
+        pool().cached_deallocate(ptr);
+    } else {
+        pool().deallocate(ptr);
+    }
+}
+
+} //end namespace mystd
@@ -0,0 +1,393 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "forward_list_iterator.hpp"
+#include "rcu_forward_list_iterator.hpp"
+#include "epoch.hpp"
+
+namespace mystd {
+
+// Read-mostly singly linked list in the read-copy-update style. Any number
+// of threads read concurrently through read(), without locks and without
+// writing to shared memory. One thread at a time modifies the list, it
+// publishes new nodes with release stores and never changes an element in
+// place: replace_after() publishes a copy instead. Unlinked nodes are freed
+// once no reader can reach them any more, see detail::EpochDomain.
+template <typename T, typename Allocator = std::allocator<T>>
+class RcuForwardList {
+    using NodeBase = detail::FwdListNodeBase<T>;
+    using Node = detail::FwdListNode<T>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    using reference = const value_type &;
+    using const_reference = const value_type &;
+
+    using size_type = Traits::size_type;
+    using difference_type = Traits::difference_type;
+
+    // elements are never modified in place, so both are read-only
+    using iterator = detail::RcuFwdListIterator<T>;
+    using const_iterator = detail::RcuFwdListIterator<T>;
+
+    class ReadView;
+
+    RcuForwardList() : RcuForwardList(Allocator{}) {}
+
+    explicit RcuForwardList(const Allocator &alloc) : alloc_(alloc) {}
+
+    RcuForwardList(std::input_iterator auto first,
+            std::input_iterator auto last,
+            const Allocator &alloc = Allocator{});
+
+    RcuForwardList(std::initializer_list<T> ilist,
+            const Allocator &alloc = Allocator{});
+
+    RcuForwardList(const RcuForwardList &) = delete;
+    RcuForwardList &operator = (const RcuForwardList &) = delete;
+
+    ~RcuForwardList();
+
+    Allocator get_allocator() const { return Allocator(alloc_); }
+
+    // reader side, any thread
+
+    // keeps the calling thread in a read section while the view lives,
+    // the nodes reached through it are not freed before
+    ReadView read() const { return ReadView(*this); }
+
+    // writer side, one thread at a time
+
+    const_iterator before_begin() const { return const_iterator(&head_); }
+    const_iterator begin() const { return ++before_begin(); }
+    const_iterator end() const { return const_iterator(); }
+
+    bool empty() const { return begin() == end(); }
+    const_reference front() const { return *begin(); }
+
+    iterator insert_after(const_iterator pos, const T &value);
+    iterator insert_after(const_iterator pos, T &&value);
+
+    template<typename ...Args>
+    iterator emplace_after(const_iterator pos, Args &&...args);
+
+    void push_front(const T &value) { insert_after(before_begin(), value); }
+    void push_front(T &&value) {
+        insert_after(before_begin(), std::move(value));
+    }
+
+    template<typename ...Args>
+    reference emplace_front(Args &&...args) {
+        return *emplace_after(before_begin(), std::forward<Args>(args)...);
+    }
+
+    // publishes a new node with value in place of the one after pos,
+    // readers see either the old or the new element
+    iterator replace_after(const_iterator pos, const T &value);
+    iterator replace_after(const_iterator pos, T &&value);
+
+    iterator erase_after(const_iterator pos);
+    void pop_front() { erase_after(before_begin()); }
+
+    size_type remove(const T &value);
+    size_type remove_if(std::predicate<const T &> auto pred);
+
+    void clear();
+
+    // frees the unlinked nodes no reader can reach any more,
+    // every modification does that already
+    void reclaim();
+
+    // waits until the readers leave the nodes unlinked so far and frees
+    // them, must not be called from inside a read section
+    void synchronize();
+
+private:
+    template <typename ...Args>
+    Node *new_node(NodeBase *next, Args &&...args);
+
+    iterator publish_after(const_iterator pos, Node *node);
+    Node *unlink_next_node(const_iterator pos);
+    void reserve_retired(size_type count);
+    void destroy_node(NodeBase *node);
+
+    // unlinked nodes with the epoch that must be reached before they are
+    // freed, the epoch is unassigned until the next reclaim()
+    struct RetiredNode {
+        std::uint64_t epoch;
+        Node *node;
+    };
+
+    static constexpr std::uint64_t unassigned_epoch = 0;
+
+    NodeBase head_;
+    std::vector<RetiredNode> retired_;
+    NodeAlloc alloc_;
+};
+
+// Read section of one thread over the list. The elements must only be
+// accessed while the view lives.
+template <typename T, typename Allocator>
+class RcuForwardList<T, Allocator>::ReadView {
+public:
+    ReadView(const ReadView &) = delete;
+    ReadView &operator = (const ReadView &) = delete;
+
+    const_iterator begin() const { return ++const_iterator(&list_.head_); }
+    const_iterator end() const { return const_iterator(); }
+
+    bool empty() const { return begin() == end(); }
+    const_reference front() const { return *begin(); }
+
+private:
+    friend class RcuForwardList;
+
+    explicit ReadView(const RcuForwardList &list) : list_(list) {}
+
+    detail::EpochGuard guard_;
+    const RcuForwardList &list_;
+};
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::RcuForwardList(
+    std::input_iterator auto first, std::input_iterator auto last,
+    const Alloc &alloc)
+    : RcuForwardList(alloc)
+{
+    for(auto pos = before_begin(); first != last; ++first) {
+        pos = insert_after(pos, *first);
+    }
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::RcuForwardList(
+    std::initializer_list<T> ilist, const Alloc &alloc)
+    : RcuForwardList(ilist.begin(), ilist.end(), alloc) {}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::~RcuForwardList() {
+    NodeBase *node = head_.next();
+
+    while(node != nullptr) {
+        NodeBase *next = node->next();
+        destroy_node(node);
+        node = next;
+    }
+
+    for(RetiredNode &retired : retired_) {
+        destroy_node(retired.node);
+    }
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::iterator
+RcuForwardList<T, Alloc>::insert_after(const_iterator pos, const T &value) {
+    return emplace_after(pos, value);
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::iterator
+RcuForwardList<T, Alloc>::insert_after(const_iterator pos, T &&value) {
+    return emplace_after(pos, std::move(value));
+}
+
+template <typename T, typename Alloc>
+template<typename ...Args>
+RcuForwardList<T, Alloc>::iterator
+RcuForwardList<T, Alloc>::emplace_after(const_iterator pos, Args &&...args) {
+    return publish_after(pos,
+            new_node(pos.next(), std::forward<Args>(args)...));
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::iterator
+RcuForwardList<T, Alloc>::replace_after(const_iterator pos, const T &value) {
+    return replace_after(pos, T(value));
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::iterator
+RcuForwardList<T, Alloc>::replace_after(const_iterator pos, T &&value) {
+    Node *old = pos.next();
+    Node *node = new_node(old->next(), std::move(value));
+
+    try {
+        reserve_retired(1);
+    } catch(...) {
+        destroy_node(node);
+        throw;
+    }
+
+    //readers that are on the old node still continue behind it
+    pos.node_->storeNext(node, std::memory_order_release);
+    retired_.push_back({unassigned_epoch, old});
+    reclaim();
+    return iterator(node);
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::iterator
+RcuForwardList<T, Alloc>::erase_after(const_iterator pos) {
+    reserve_retired(1);
+    retired_.push_back({unassigned_epoch, unlink_next_node(pos)});
+    reclaim();
+    return ++pos;
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::size_type
+RcuForwardList<T, Alloc>::remove(const T &value) {
+    return remove_if([&value](const T &element) {
+            return element == value;
+        });
+}
+
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::size_type
+RcuForwardList<T, Alloc>::remove_if(std::predicate<const T &> auto pred) {
+    size_type count = 0;
+    auto prev = before_begin();
+
+    for(auto curr = begin(); curr != end(); curr = std::next(prev)) {
+        if(pred(*curr)) {
+            reserve_retired(1);
+            retired_.push_back({unassigned_epoch, unlink_next_node(prev)});
+            ++count;
+        } else {
+            prev = curr;
+        }
+    }
+
+    if(count > 0) {
+        reclaim();
+    }
+
+    return count;
+}
+
+template <typename T, typename Alloc>
+void RcuForwardList<T, Alloc>::clear() {
+    size_type count = std::distance(begin(), end());
+    reserve_retired(count);
+
+    Node *node = head_.next();
+    head_.storeNext(nullptr, std::memory_order_release);
+
+    for(; node != nullptr; node = node->next()) {
+        retired_.push_back({unassigned_epoch, node});
+    }
+
+    reclaim();
+}
+
+//the nodes unlinked since the last call get the next epoch, the nodes
+//whose epoch every reader has reached are freed
+template <typename T, typename Alloc>
+void RcuForwardList<T, Alloc>::reclaim() {
+    if(retired_.empty()) {
+        return;
+    }
+
+    detail::EpochDomain &domain = detail::EpochDomain::instance();
+
+    if(retired_.back().epoch == unassigned_epoch) {
+        std::uint64_t epoch = domain.advance();
+
+        for(auto it = retired_.rbegin();
+                it != retired_.rend() && it->epoch == unassigned_epoch; ++it)
+        {
+            it->epoch = epoch;
+        }
+    }
+
+    //the epochs grow along the vector
+    std::uint64_t min_active = domain.min_active();
+    auto reachable = std::find_if(retired_.begin(), retired_.end(),
+            [min_active](const RetiredNode &retired) {
+                return retired.epoch > min_active;
+            });
+
+    for(auto it = retired_.begin(); it != reachable; ++it) {
+        destroy_node(it->node);
+    }
+
+    retired_.erase(retired_.begin(), reachable);
+}
+
+template <typename T, typename Alloc>
+void RcuForwardList<T, Alloc>::synchronize() {
+    detail::EpochDomain::instance().synchronize();
+
+    for(RetiredNode &retired : retired_) {
+        destroy_node(retired.node);
+    }
+
+    retired_.clear();
+}
+
+template <typename T, typename Alloc>
+template <typename ...Args>
+typename RcuForwardList<T, Alloc>::Node *
+RcuForwardList<T, Alloc>::new_node(NodeBase *next, Args &&...args) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+
+    try {
+        NodeTraits::construct(alloc_, node, next, std::forward<Args>(args)...);
+    } catch(...) {
+        NodeTraits::deallocate(alloc_, node, 1);
+        throw;
+    }
+
+    return node;
+}
+
+//the node is complete before the release store makes it reachable
+template <typename T, typename Alloc>
+RcuForwardList<T, Alloc>::iterator
+RcuForwardList<T, Alloc>::publish_after(const_iterator pos, Node *node) {
+    pos.node_->storeNext(node, std::memory_order_release);
+    return iterator(node);
+}
+
+//the link of the unlinked node stays intact for the readers on it
+template <typename T, typename Alloc>
+typename RcuForwardList<T, Alloc>::Node *
+RcuForwardList<T, Alloc>::unlink_next_node(const_iterator pos) {
+    Node *node = pos.next();
+    pos.node_->storeNext(node->next(), std::memory_order_release);
+    return node;
+}
+
+//makes room for count retired nodes before anything is unlinked, 
+//so an unlinked node is never lost
+template <typename T, typename Alloc>
+void RcuForwardList<T, Alloc>::reserve_retired(size_type count) {
+    if(retired_.capacity() - retired_.size() < count) {
+        retired_.reserve(std::max(2 * retired_.capacity(), 
+                    retired_.size() + count));
+    }
+}
+
+template <typename T, typename Alloc>
+void RcuForwardList<T, Alloc>::destroy_node(NodeBase *node) {
+    Node *value_node = static_cast<Node *>(node);
+    NodeTraits::destroy(alloc_, value_node);
+    NodeTraits::deallocate(alloc_, value_node, 1);
+}
+
+} //end namespace mystd
@@ -0,0 +1,576 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "skip_list_node.hpp"
+#include "forward_list_iterator.hpp"
+#include "concepts.hpp"
+
+namespace mystd {
+
+// Ordered multiset of keys linked in several levels. Level 0 holds every
+// node in order, each upper level about a quarter of the nodes of the level
+// below, so find, lower_bound, insert and erase walk O(log n) nodes on
+// average. Equal keys stay in the order of their insertion.
+//
+// Level 0 is a forward list of FwdListNodes, so the iterators are the const
+// iterators of ForwardList<K> and the nodes can be walked by any code that
+// takes them. The keys can't be changed through the iterators.
+//
+// mystd::SkipList<int> set{5, 1, 3};
+template <typename K,
+         typename Compare = std::less<K>,
+         typename Allocator = std::allocator<K>>
+class SkipList {
+    using NodeBase = detail::FwdListNodeBase<K>;
+    using Node = detail::SkipListNode<K>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+
+public:
+    using key_type = K;
+    using value_type = K;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    using reference = const value_type &;
+    using const_reference = const value_type &;
+
+    using pointer = Traits::const_pointer;
+    using const_pointer = Traits::const_pointer;
+
+    using size_type = Traits::size_type;
+    using difference_type = Traits::difference_type;
+
+    using iterator = detail::FwdListIterator<true, K>;
+    using const_iterator = detail::FwdListIterator<true, K>;
+
+    // the number of levels, enough for 4^max_height keys
+    static constexpr std::size_t max_height = 24;
+
+    SkipList() : SkipList(Compare{}) {}
+
+    explicit SkipList(const Compare &comp,
+            const Allocator &alloc = Allocator{})
+        : comp_(comp), alloc_(alloc) {}
+
+    explicit SkipList(const Allocator &alloc)
+        : SkipList(Compare{}, alloc) {}
+
+    SkipList(std::input_iterator auto first,
+            std::input_iterator auto last,
+            const Compare &comp = Compare{},
+            const Allocator &alloc = Allocator{});
+
+    SkipList(std::initializer_list<K> ilist,
+            const Compare &comp = Compare{},
+            const Allocator &alloc = Allocator{});
+
+    SkipList(const SkipList &other);
+    SkipList(SkipList &&other);
+
+    ~SkipList() { clear(); }
+
+    SkipList &operator = (const SkipList &other);
+    SkipList &operator = (SkipList &&other);
+    SkipList &operator = (std::initializer_list<K> ilist);
+
+    Allocator get_allocator() const { return Allocator(alloc_); }
+    key_compare key_comp() const { return comp_; }
+    value_compare value_comp() const { return comp_; }
+
+    const_iterator before_begin() const { return cbefore_begin(); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+    const_iterator cbefore_begin() const { return const_iterator(head()); }
+    const_iterator cbegin() const { return const_iterator(head_.next()); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+
+    void clear();
+
+    // the key goes after the keys equal to it
+    iterator insert(const K &key) { return emplace(key); }
+    iterator insert(K &&key) { return emplace(std::move(key)); }
+    void insert(std::input_iterator auto first, std::input_iterator auto last);
+    void insert(std::initializer_list<K> ilist);
+
+    template <typename ...Args>
+    iterator emplace(Args &&...args);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    // erases all keys equal to key, returns their number
+    size_type erase(const K &key);
+
+    const_iterator find(const K &key) const;
+    bool contains(const K &key) const { return find(key) != end(); }
+    size_type count(const K &key) const;
+
+    // the first key that is not less than key
+    const_iterator lower_bound(const K &key) const;
+    // the first key that is greater than key
+    const_iterator upper_bound(const K &key) const;
+    std::pair<const_iterator, const_iterator> equal_range(const K &key) const;
+
+    void swap(SkipList &other);
+
+private:
+    NodeBase *head() const { return const_cast<NodeBase *>(&head_); }
+
+    NodeBase *next(NodeBase *pos, std::size_t level) const;
+    void setNext(NodeBase *pos, std::size_t level, NodeBase *next);
+
+    // the last node of every level whose key goes before key, that is less
+    // than key or, for Upper, not greater than it
+    template <bool Upper>
+    NodeBase *search(const K &key, NodeBase **update) const;
+
+    // links the node after the last nodes of every level in update
+    void link(Node *node, NodeBase **update);
+    // builds the empty list from sorted keys in O(1) per key
+    void append(std::input_iterator auto first, std::input_iterator auto last);
+
+    std::size_t random_height();
+
+    template <typename ...Args>
+    Node *new_node(Args &&...args);
+    void delete_node(Node *node);
+
+    void steal(SkipList &other);
+
+    NodeBase head_;
+    std::array<NodeBase *, max_height - 1> head_links_{};
+    std::size_t height_ = 1;
+    size_type size_ = 0;
+    std::uint64_t seed_ = 0x9e3779b97f4a7c15;
+
+    [[no_unique_address]] Compare comp_;
+    [[no_unique_address]] NodeAlloc alloc_;
+};
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::SkipList(
+        std::input_iterator auto first,
+        std::input_iterator auto last,
+        const Compare &comp,
+        const Allocator &alloc)
+    : SkipList(comp, alloc)
+{
+    insert(first, last);
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::SkipList(
+        std::initializer_list<K> ilist,
+        const Compare &comp,
+        const Allocator &alloc)
+    : SkipList(comp, alloc)
+{
+    insert(ilist);
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::SkipList(const SkipList &other)
+    : SkipList(other.comp_,
+        Traits::select_on_container_copy_construction(
+            Allocator(other.alloc_)))
+{
+    append(other.begin(), other.end());
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::SkipList(SkipList &&other)
+    : comp_(other.comp_), alloc_(other.alloc_)
+{
+    steal(other);
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator> &
+SkipList<K, Compare, Allocator>::operator = (const SkipList &other) {
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    clear();
+
+    if(NodeTraits::propagate_on_container_copy_assignment::value) {
+        alloc_ = other.alloc_;
+    }
+
+    comp_ = other.comp_;
+    append(other.begin(), other.end());
+    return *this;
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator> &
+SkipList<K, Compare, Allocator>::operator = (SkipList &&other) {
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    clear();
+    comp_ = other.comp_;
+
+    if(NodeTraits::propagate_on_container_move_assignment::value) {
+        alloc_ = std::move(other.alloc_);
+        steal(other);
+    } else if(alloc_ == other.alloc_) {
+        steal(other);
+    } else {
+        append(std::move_iterator(other.begin()),
+                std::move_iterator(other.end()));
+        other.clear();
+    }
+
+    return *this;
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator> &
+SkipList<K, Compare, Allocator>::operator = (std::initializer_list<K> ilist) {
+    clear();
+    insert(ilist);
+    return *this;
+}
+
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::clear() {
+    for(NodeBase *node = head_.next(); node != nullptr;) {
+        auto *curr = static_cast<Node *>(node);
+        node = curr->next();
+        delete_node(curr);
+    }
+
+    head_.setNext(nullptr);
+    head_links_.fill(nullptr);
+    height_ = 1;
+    size_ = 0;
+}
+
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::insert(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    for(; first != last; ++first) {
+        emplace(*first);
+    }
+}
+
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::insert(std::initializer_list<K> ilist) {
+    insert(ilist.begin(), ilist.end());
+}
+
+//the node is built first, its key is what the search compares with
+template <typename K, typename Compare, typename Allocator>
+template <typename ...Args>
+SkipList<K, Compare, Allocator>::iterator
+SkipList<K, Compare, Allocator>::emplace(Args &&...args) {
+    Node *node = new_node(std::forward<Args>(args)...);
+    std::array<NodeBase *, max_height> update;
+
+    try {
+        search<true>(node->value(), update.data());
+    } catch(...) {
+        delete_node(node);
+        throw;
+    }
+
+    link(node, update.data());
+    return iterator(node);
+}
+
+//the keys equal to the one of pos that go before it are walked on level 0,
+//they may be the last nodes before pos on the upper levels
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::iterator
+SkipList<K, Compare, Allocator>::erase(const_iterator pos) {
+    auto *node = static_cast<Node *>(pos.node());
+    std::array<NodeBase *, max_height> update;
+    search<false>(node->value(), update.data());
+
+    for(NodeBase *curr = update[0]->next(); curr != node;
+            curr = curr->next())
+    {
+        auto *equal = static_cast<Node *>(curr);
+
+        for(std::size_t level = 0; level < equal->height(); ++level) {
+            update[level] = equal;
+        }
+    }
+
+    for(std::size_t level = 0; level < node->height(); ++level) {
+        setNext(update[level], level, next(node, level));
+    }
+
+    while(height_ > 1 && head_links_[height_ - 2] == nullptr) {
+        --height_;
+    }
+
+    NodeBase *following = node->next();
+    delete_node(node);
+    --size_;
+    return iterator(following);
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::iterator
+SkipList<K, Compare, Allocator>::erase(
+        const_iterator first,
+        const_iterator last)
+{
+    while(first != last) {
+        first = erase(first);
+    }
+
+    return iterator(last.node_);
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::size_type
+SkipList<K, Compare, Allocator>::erase(const K &key) {
+    size_type count = 0;
+
+    for(auto it = find(key); it != end() && !comp_(key, *it); ++count) {
+        it = erase(it);
+    }
+
+    return count;
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::const_iterator
+SkipList<K, Compare, Allocator>::find(const K &key) const {
+    const_iterator it = lower_bound(key);
+
+    if(it != end() && !comp_(key, *it)) {
+        return it;
+    }
+
+    return end();
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::size_type
+SkipList<K, Compare, Allocator>::count(const K &key) const {
+    auto [first, last] = equal_range(key);
+    return static_cast<size_type>(std::distance(first, last));
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::const_iterator
+SkipList<K, Compare, Allocator>::lower_bound(const K &key) const {
+    return const_iterator(search<false>(key, nullptr)->next());
+}
+
+template <typename K, typename Compare, typename Allocator>
+SkipList<K, Compare, Allocator>::const_iterator
+SkipList<K, Compare, Allocator>::upper_bound(const K &key) const {
+    return const_iterator(search<true>(key, nullptr)->next());
+}
+
+template <typename K, typename Compare, typename Allocator>
+std::pair<typename SkipList<K, Compare, Allocator>::const_iterator,
+          typename SkipList<K, Compare, Allocator>::const_iterator>
+SkipList<K, Compare, Allocator>::equal_range(const K &key) const {
+    const_iterator first = lower_bound(key);
+    const_iterator last = first;
+
+    while(last != end() && !comp_(key, *last)) {
+        ++last;
+    }
+
+    return {first, last};
+}
+
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::swap(SkipList &other) {
+    std::swap(*this, other);
+}
+
+template <typename K, typename Compare, typename Allocator>
+typename SkipList<K, Compare, Allocator>::NodeBase *
+SkipList<K, Compare, Allocator>::next(NodeBase *pos, std::size_t level) const {
+    if(level == 0) {
+        return pos->next();
+    }
+
+    if(pos == &head_) {
+        return head_links_[level - 1];
+    }
+
+    return static_cast<Node *>(pos)->upper(level);
+}
+
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::setNext(
+        NodeBase *pos,
+        std::size_t level,
+        NodeBase *next)
+{
+    if(level == 0) {
+        pos->setNext(next);
+    } else if(pos == &head_) {
+        head_links_[level - 1] = next;
+    } else {
+        static_cast<Node *>(pos)->upper(level) = next;
+    }
+}
+
+template <typename K, typename Compare, typename Allocator>
+template <bool Upper>
+typename SkipList<K, Compare, Allocator>::NodeBase *
+SkipList<K, Compare, Allocator>::search(
+        const K &key,
+        NodeBase **update) const
+{
+    auto goes_before = [this, &key](NodeBase *node) {
+        const K &other = static_cast<Node *>(node)->value();
+
+        if constexpr(Upper) {
+            return !comp_(key, other);
+        } else {
+            return comp_(other, key);
+        }
+    };
+
+    NodeBase *pos = head();
+
+    for(std::size_t level = height_; level-- > 0;) {
+        for(NodeBase *node = next(pos, level);
+                node != nullptr && goes_before(node);
+                node = next(pos, level))
+        {
+            pos = node;
+        }
+
+        if(update != nullptr) {
+            update[level] = pos;
+        }
+    }
+
+    return pos;
+}
+
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::link(Node *node, NodeBase **update) {
+    for(; height_ < node->height(); ++height_) {
+        update[height_] = &head_;
+    }
+
+    for(std::size_t level = 0; level < node->height(); ++level) {
+        setNext(node, level, next(update[level], level));
+        setNext(update[level], level, node);
+    }
+
+    ++size_;
+}
+
+//the last node of every level is kept, a key is linked after them
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::append(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    std::array<NodeBase *, max_height> tails;
+    tails.fill(&head_);
+
+    for(; first != last; ++first) {
+        Node *node = new_node(*first);
+        link(node, tails.data());
+
+        for(std::size_t level = 0; level < node->height(); ++level) {
+            tails[level] = node;
+        }
+    }
+}
+
+//every level above the first is taken with probability 1/4, two random bits
+template <typename K, typename Compare, typename Allocator>
+std::size_t SkipList<K, Compare, Allocator>::random_height() {
+    seed_ ^= seed_ << 13;
+    seed_ ^= seed_ >> 7;
+    seed_ ^= seed_ << 17;
+
+    std::uint64_t bits = seed_ | std::uint64_t{1} << 2 * (max_height - 1);
+    return 1 + static_cast<std::size_t>(std::countr_zero(bits)) / 2;
+}
+
+template <typename K, typename Compare, typename Allocator>
+template <typename ...Args>
+typename SkipList<K, Compare, Allocator>::Node *
+SkipList<K, Compare, Allocator>::new_node(Args &&...args) {
+    std::size_t height = random_height();
+    std::size_t units = Node::units(height);
+    Node *node = NodeTraits::allocate(alloc_, units);
+
+    try {
+        NodeTraits::construct(alloc_, node, height,
+                std::forward<Args>(args)...);
+    } catch(...) {
+        NodeTraits::deallocate(alloc_, node, units);
+        throw;
+    }
+
+    return node;
+}
+
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::delete_node(Node *node) {
+    std::size_t units = Node::units(node->height());
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, units);
+}
+
+//the nodes don't refer to the head, so its links are just copied
+template <typename K, typename Compare, typename Allocator>
+void SkipList<K, Compare, Allocator>::steal(SkipList &other) {
+    head_.setNext(other.head_.next());
+    head_links_ = other.head_links_;
+    height_ = other.height_;
+    size_ = other.size_;
+
+    other.head_.setNext(nullptr);
+    other.head_links_.fill(nullptr);
+    other.height_ = 1;
+    other.size_ = 0;
+}
+
+template <typename K, typename Compare, typename Allocator>
+bool operator == (
+        const SkipList<K, Compare, Allocator> &lhs,
+        const SkipList<K, Compare, Allocator> &rhs)
+{
+    return lhs.size() == rhs.size() &&
+        std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename K, typename Compare, typename Allocator>
+auto operator <=> (
+        const SkipList<K, Compare, Allocator> &lhs,
+        const SkipList<K, Compare, Allocator> &rhs)
+{
+    return std::lexicographical_compare_three_way(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end()
+        );
+}
+
+} //end namespace mystd
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "hash_table.hpp"
+
+namespace mystd {
+
+// Map with unique keys in a chained hash table. All elements form one
+// forward list of FwdListNodes, the buckets point into it, see
+// detail::HashTable. Rehashing doesn't invalidate iterators or references,
+// as it only relinks the nodes.
+//
+// mystd::UnorderedMap<std::string, int> counts;
+// ++counts["word"];
+template <typename Key,
+         typename T,
+         typename Hash = std::hash<Key>,
+         typename KeyEqual = std::equal_to<Key>,
+         typename Allocator = std::allocator<std::pair<const Key, T>>>
+class UnorderedMap : public detail::HashTable<std::pair<const Key, T>,
+                                              detail::FirstKey, Hash, KeyEqual,
+                                              Allocator> {
+    using Table = detail::HashTable<std::pair<const Key, T>,
+          detail::FirstKey, Hash, KeyEqual, Allocator>;
+    using Node = typename Table::Node;
+
+public:
+    using mapped_type = T;
+    using typename Table::iterator;
+
+    using Table::Table;
+    using Table::operator =;
+
+    T &operator [] (const Key &key) { return try_emplace(key).first->second; }
+    T &operator [] (Key &&key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    // throws std::out_of_range if there is no such key
+    T &at(const Key &key);
+    const T &at(const Key &key) const;
+
+    // builds the element only if the key is not in the map yet
+    template <typename ...Args>
+    std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+    template <typename ...Args>
+    std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key &key, M &&value);
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(Key &&key, M &&value);
+
+private:
+    template <typename K, typename ...Args>
+    std::pair<iterator, bool> emplace_key(K &&key, Args &&...args);
+    template <typename K, typename M>
+    std::pair<iterator, bool> assign_key(K &&key, M &&value);
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+T &UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::at(const Key &key) {
+    auto it = this->find(key);
+
+    if(it == this->end()) {
+        throw std::out_of_range("UnorderedMap::at: no such key");
+    }
+
+    return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+const T &UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::at(const Key &key) const {
+    auto it = this->find(key);
+
+    if(it == this->end()) {
+        throw std::out_of_range("UnorderedMap::at: no such key");
+    }
+
+    return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename ...Args>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::try_emplace(
+        const Key &key,
+        Args &&...args)
+{
+    return emplace_key(key, std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename ...Args>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::try_emplace(
+        Key &&key,
+        Args &&...args)
+{
+    return emplace_key(std::move(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename M>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::insert_or_assign(
+        const Key &key,
+        M &&value)
+{
+    return assign_key(key, std::forward<M>(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename M>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::insert_or_assign(
+        Key &&key,
+        M &&value)
+{
+    return assign_key(std::move(key), std::forward<M>(value));
+}
+
+//the key is looked up before a node is built
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename K, typename ...Args>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::emplace_key(
+        K &&key,
+        Args &&...args)
+{
+    std::size_t hash = this->hash_key(key);
+
+    if(Node *found = this->find_node(key, hash)) {
+        return {this->node_iterator(found), false};
+    }
+
+    this->reserve_one();
+    Node *node = this->new_node(std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+    node->hash_ = hash;
+    return {this->link_node(node), true};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename K, typename M>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual, Alloc>::assign_key(K &&key, M &&value) {
+    auto result = emplace_key(std::forward<K>(key), std::forward<M>(value));
+
+    if(!result.second) {
+        result.first->second = std::forward<M>(value);
+    }
+
+    return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Alloc>
+void swap(
+        UnorderedMap<Key, T, Hash, KeyEqual, Alloc> &lhs,
+        UnorderedMap<Key, T, Hash, KeyEqual, Alloc> &rhs)
+{
+    lhs.swap(rhs);
+}
+
+} //end namespace mystd
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "hash_table.hpp"
+
+namespace mystd {
+
+// Set of unique keys in a chained hash table. All elements form one forward
+// list of FwdListNodes, the buckets point into it, see detail::HashTable.
+// Rehashing doesn't invalidate iterators or references, as it only relinks
+// the nodes. The iterators are forward iterators over the keys.
+//
+// mystd::UnorderedSet<std::string, std::hash<std::string>,
+//     std::equal_to<std::string>, mystd::NodePoolAllocator<std::string>> set;
+template <typename Key,
+         typename Hash = std::hash<Key>,
+         typename KeyEqual = std::equal_to<Key>,
+         typename Allocator = std::allocator<Key>>
+class UnorderedSet : public detail::HashTable<Key, detail::IdentityKey,
+                                              Hash, KeyEqual, Allocator> {
+    using Table = detail::HashTable<Key, detail::IdentityKey,
+          Hash, KeyEqual, Allocator>;
+
+public:
+    using Table::Table;
+    using Table::operator =;
+};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+void swap(
+        UnorderedSet<Key, Hash, KeyEqual, Allocator> &lhs,
+        UnorderedSet<Key, Hash, KeyEqual, Allocator> &rhs)
+{
+    lhs.swap(rhs);
+}
+
+} //end namespace mystd
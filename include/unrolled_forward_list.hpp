@@ -0,0 +1,972 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "unrolled_forward_list_node.hpp"
+#include "unrolled_forward_list_iterator.hpp"
+#include "concepts.hpp"
+
+namespace mystd {
+
+// Singly linked list that stores up to N elements per node. It has the
+// interface of ForwardList, but iteration touches one node per N elements.
+//
+// Elements are moved inside and between nodes, so an insertion or erasure
+// invalidates the iterators to the elements of the affected nodes. The
+// splice_after overloads that take an element or a range move the elements
+// and require other to be a different list. T must be nothrow move
+// constructible.
+template <typename T,
+         std::size_t N = detail::unrolled_capacity<T>,
+         typename Allocator = std::allocator<T>>
+class UnrolledForwardList {
+    static_assert(N > 0, "a node must hold at least one element");
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+            "elements are relocated between slots and must not throw on move");
+
+    using NodeBase = detail::UnrolledFwdListNodeBase<T, N>;
+    using Node = detail::UnrolledFwdListNode<T, N>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    using pointer = Traits::pointer;
+    using const_pointer = Traits::const_pointer;
+
+    using size_type = Traits::size_type;
+    using difference_type = Traits::difference_type;
+
+    using iterator = detail::UnrolledFwdListIterator<false, T, N>;
+    using const_iterator = detail::UnrolledFwdListIterator<true, T, N>;
+
+    static constexpr size_type node_capacity = N;
+
+    UnrolledForwardList();
+
+    explicit UnrolledForwardList(const Allocator &alloc);
+
+    UnrolledForwardList(const UnrolledForwardList &other);
+
+    UnrolledForwardList(const UnrolledForwardList &other,
+            const Allocator &alloc);
+
+    UnrolledForwardList(UnrolledForwardList &&other);
+
+    UnrolledForwardList(UnrolledForwardList &&other, const Allocator &alloc);
+
+    explicit UnrolledForwardList(size_type count,
+            const Allocator &alloc = Allocator{});
+
+    UnrolledForwardList(size_type count,
+            const T &value,
+            const Allocator &alloc = Allocator{});
+
+    UnrolledForwardList(std::input_iterator auto first,
+            std::input_iterator auto last,
+            const Allocator &alloc = Allocator{});
+
+    UnrolledForwardList(std::initializer_list<T> ilist,
+            const Allocator &alloc = Allocator{});
+
+    ~UnrolledForwardList();
+
+    UnrolledForwardList &operator = (const UnrolledForwardList &other);
+    UnrolledForwardList &operator = (UnrolledForwardList &&other);
+    UnrolledForwardList &operator = (std::initializer_list<T> ilist);
+
+    Allocator get_allocator() const { return Allocator(alloc_); }
+
+    reference front() { return head_.next()->value(0); }
+    const_reference front() const { return head_.next()->value(0); }
+
+    iterator before_begin() { return iterator(&head_, before_first); }
+    iterator begin() { return iterator(head_.next(), 0); }
+    iterator end() { return iterator(nullptr, 0); }
+
+    const_iterator before_begin() const { return cbefore_begin(); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+    const_iterator cbefore_begin() const {
+        return const_iterator(const_cast<NodeBase *>(&head_), before_first);
+    }
+    const_iterator cbegin() const { return const_iterator(head_.next(), 0); }
+    const_iterator cend() const { return const_iterator(nullptr, 0); }
+
+    bool empty() const { return head_.next() == nullptr; }
+    size_type max_size() const {
+        return std::numeric_limits<difference_type>::max();
+    }
+
+    iterator insert_after(const_iterator pos, const T& value);
+    iterator insert_after(const_iterator pos, T&& value);
+    iterator insert_after(const_iterator pos, size_type count, const T& value);
+    iterator insert_after(const_iterator pos, std::initializer_list<T> ilist);
+    iterator insert_after(const_iterator pos,
+            std::input_iterator auto first,
+            std::input_iterator auto last);
+
+    template<typename ...Args>
+    iterator emplace_after(const_iterator pos, Args &&...args);
+
+    void clear();
+
+    iterator erase_after(const_iterator pos);
+    iterator erase_after(const_iterator first, const_iterator last);
+
+    void push_front(const T &value);
+    void push_front(T &&value);
+
+    template<class... Args>
+    reference emplace_front(Args &&...args);
+
+    void pop_front() { erase_after(before_begin()); };
+
+    void resize(size_type count);
+    void resize(size_type count, const value_type& value);
+
+    void swap(UnrolledForwardList &other);
+
+    void merge(UnrolledForwardList &other);
+    void merge(UnrolledForwardList &&other);
+    void merge(UnrolledForwardList &other, detail::compare<T> auto comp);
+    void merge(UnrolledForwardList &&other, detail::compare<T> auto comp);
+
+    void splice_after(const_iterator pos, UnrolledForwardList &other);
+
+    void splice_after(const_iterator pos, UnrolledForwardList &other,
+            const_iterator it);
+
+    void splice_after(const_iterator pos, UnrolledForwardList &other,
+            const_iterator first, const_iterator last);
+
+    size_type remove(const T& value);
+    size_type remove_if(std::predicate<T> auto pred);
+
+    void reverse();
+
+    size_type unique();
+    size_type unique(detail::compare<T> auto pred);
+
+    void sort();
+    void sort(detail::compare<T> auto comp);
+
+    void assign(std::input_iterator auto first, std::input_iterator auto last);
+
+private:
+    static constexpr std::size_t before_first = iterator::before_first;
+
+    iterator open_after(const_iterator pos);
+    void truncate_after(const_iterator pos);
+
+    // removes the elements for which remove(value, last_kept) returns true
+    // and packs the rest into full nodes, last_kept is nullptr for the first
+    size_type compact(auto remove);
+
+    // moves buffer back into the slots of the list in order
+    void refill(std::vector<T> &buffer);
+    std::vector<T> take_elements(size_type reserve);
+
+    NodeBase *last_node();
+
+    Node *new_node(NodeBase *next);
+    void delete_node(Node *node);
+    void delete_chain(Node *node);
+
+    NodeBase head_;
+    NodeAlloc alloc_;
+};
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList()
+    : head_(nullptr), alloc_(Alloc{}) {}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(const Alloc &alloc)
+    : head_(nullptr), alloc_(alloc) {}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        const UnrolledForwardList &other)
+    : UnrolledForwardList(other,
+        Traits::select_on_container_copy_construction(other.get_allocator()))
+{}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        const UnrolledForwardList &other,
+        const Alloc &alloc)
+    : UnrolledForwardList(alloc)
+{
+    assign(other.cbegin(), other.cend());
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        UnrolledForwardList &&other)
+    : head_(other.head_.next()), alloc_(std::move(other.alloc_))
+{
+    other.head_.setNext(nullptr);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        UnrolledForwardList &&other,
+        const Alloc &alloc)
+    : UnrolledForwardList(alloc)
+{
+    if(NodeTraits::is_always_equal::value || alloc_ == other.alloc_) {
+        head_.setNext(other.head_.next());
+        other.head_.setNext(nullptr);
+    } else {
+        assign(std::move_iterator(other.begin()),
+               std::move_iterator(other.end()));
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        size_type count,
+        const Alloc &alloc)
+    : UnrolledForwardList(alloc)
+{
+    resize(count);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        size_type count,
+        const T &value,
+        const Alloc &alloc)
+    : UnrolledForwardList(alloc)
+{
+    insert_after(before_begin(), count, value);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        std::input_iterator auto first,
+        std::input_iterator auto last,
+        const Alloc &alloc)
+    : UnrolledForwardList(alloc)
+{
+    insert_after(before_begin(), first, last);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::UnrolledForwardList(
+        std::initializer_list<T> ilist,
+        const Alloc &alloc)
+    : UnrolledForwardList(alloc)
+{
+    insert_after(before_begin(), ilist);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::~UnrolledForwardList() {
+    clear();
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc> &
+UnrolledForwardList<T, N, Alloc>::operator = (
+        const UnrolledForwardList &other)
+{
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    if(NodeTraits::propagate_on_container_copy_assignment::value
+            && alloc_ != other.alloc_) {
+        clear();
+        alloc_ = other.alloc_;
+    }
+
+    assign(other.cbegin(), other.cend());
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc> &
+UnrolledForwardList<T, N, Alloc>::operator = (UnrolledForwardList &&other) {
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    if(NodeTraits::propagate_on_container_move_assignment::value) {
+        clear();
+        alloc_ = std::move(other.alloc_);
+        head_.setNext(other.head_.next());
+        other.head_.setNext(nullptr);
+    } else if(NodeTraits::is_always_equal::value || alloc_ == other.alloc_) {
+        clear();
+        head_.setNext(other.head_.next());
+        other.head_.setNext(nullptr);
+    } else {
+        assign(std::move_iterator(other.begin()),
+               std::move_iterator(other.end()));
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc> &
+UnrolledForwardList<T, N, Alloc>::operator = (std::initializer_list<T> ilist) {
+    assign(ilist.begin(), ilist.end());
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::insert_after(
+        const_iterator pos,
+        const T& value)
+{
+    return emplace_after(pos, value);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::insert_after(
+        const_iterator pos,
+        T&& value)
+{
+    return emplace_after(pos, std::move(value));
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::insert_after(
+        const_iterator pos,
+        size_type count,
+        const T& value)
+{
+    iterator it(pos.node_, pos.index_);
+
+    for(size_type i = 0; i < count; ++i) {
+        it = emplace_after(it, value);
+    }
+
+    return it;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::insert_after(
+        const_iterator pos,
+        std::initializer_list<T> ilist)
+{
+    return insert_after(pos, ilist.begin(), ilist.end());
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::insert_after(
+        const_iterator pos,
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    iterator it(pos.node_, pos.index_);
+
+    for(; first != last; ++first) {
+        it = emplace_after(it, *first);
+    }
+
+    return it;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+template<typename ...Args>
+UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::emplace_after(
+        const_iterator pos,
+        Args &&...args)
+{
+    if constexpr(!std::is_nothrow_constructible_v<T, Args...>) {
+        //a throwing constructor must not leave an opened slot behind
+        return emplace_after(pos, T(std::forward<Args>(args)...));
+    } else {
+        iterator it = open_after(pos);
+        NodeTraits::construct(alloc_, it.node()->slot(it.index_),
+                std::forward<Args>(args)...);
+        return it;
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::clear() {
+    delete_chain(head_.next());
+    head_.setNext(nullptr);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+typename UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::erase_after(const_iterator pos) {
+    iterator target(pos.node_, pos.index_);
+    ++target;
+
+    if(target == end()) {
+        return end();
+    }
+
+    Node *node = target.node();
+    NodeTraits::destroy(alloc_, node->slot(target.index_));
+    node->close(target.index_);
+
+    if(node->size() == 0) {
+        //an element at index 0 follows either the head
+        //or the last element of the previous node
+        pos.node_->setNext(node->next());
+        delete_node(node);
+        return iterator(pos.node_->next(), 0);
+    }
+
+    if(target.index_ == node->size()) {
+        return iterator(node->next(), 0);
+    }
+
+    return target;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+typename UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::erase_after(
+        const_iterator first,
+        const_iterator last)
+{
+    if(last == cend()) {
+        truncate_after(first);
+        return end();
+    }
+
+    //erasing shifts the elements that follow in the node,
+    //so last can't be compared against after the first erasure
+    difference_type count = std::distance(first, last) - 1;
+    iterator it(last.node_, last.index_);
+
+    for(; count > 0; --count) {
+        it = erase_after(first);
+    }
+
+    return it;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::push_front(const T &value) {
+    emplace_after(before_begin(), value);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::push_front(T &&value) {
+    emplace_after(before_begin(), std::move(value));
+}
+
+template <typename T, std::size_t N, typename Alloc>
+template<typename ...Args>
+UnrolledForwardList<T, N, Alloc>::reference
+UnrolledForwardList<T, N, Alloc>::emplace_front(Args &&...args) {
+    return *emplace_after(before_begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::resize(size_type count) {
+    iterator it = before_begin();
+    size_type size = 0;
+
+    for(; size < count && std::next(it) != end(); ++size, ++it);
+
+    if(size == count) {
+        truncate_after(it);
+        return;
+    }
+
+    for(; size < count; ++size) {
+        it = emplace_after(it);
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::resize(
+        size_type count,
+        const value_type &value)
+{
+    iterator it = before_begin();
+    size_type size = 0;
+
+    for(; size < count && std::next(it) != end(); ++size, ++it);
+
+    if(size == count) {
+        truncate_after(it);
+        return;
+    }
+
+    insert_after(it, count - size, value);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::swap(UnrolledForwardList &other) {
+    NodeBase *head = head_.next();
+    head_.setNext(other.head_.next());
+    other.head_.setNext(head);
+
+    if constexpr(NodeTraits::propagate_on_container_swap::value) {
+        std::swap(alloc_, other.alloc_);
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::merge(UnrolledForwardList &other) {
+    merge(std::move(other), std::less<T>{});
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::merge(UnrolledForwardList &&other) {
+    merge(std::move(other), std::less<T>{});
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::merge(
+        UnrolledForwardList &other,
+        detail::compare<T> auto comp)
+{
+    merge(std::move(other), comp);
+}
+
+//the nodes of other are appended to this list, then the elements
+//of both lists are merged in a buffer and moved back in order
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::merge(
+        UnrolledForwardList &&other,
+        detail::compare<T> auto comp)
+{
+    if(std::addressof(*this) == std::addressof(other) || other.empty()) {
+        return;
+    }
+
+    std::vector<T> buffer = take_elements(
+            std::distance(begin(), end())
+            + std::distance(other.begin(), other.end()));
+    auto middle = static_cast<difference_type>(buffer.size());
+
+    buffer.insert(buffer.end(),
+            std::move_iterator(other.begin()),
+            std::move_iterator(other.end()));
+
+    last_node()->setNext(other.head_.next());
+    other.head_.setNext(nullptr);
+
+    try {
+        std::inplace_merge(buffer.begin(), buffer.begin() + middle,
+                buffer.end(), comp);
+    } catch(...) {
+        refill(buffer);
+        throw;
+    }
+
+    refill(buffer);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::splice_after(
+        const_iterator pos,
+        UnrolledForwardList &other)
+{
+    if(std::addressof(*this) == std::addressof(other) || other.empty()) {
+        return;
+    }
+
+    NodeBase *before = pos.node_;
+
+    //cut the node of pos after pos, so the nodes of other fit in between
+    if(!pos.is_before_first() && pos.index_ + 1 < pos.node()->size()) {
+        Node *node = pos.node();
+        Node *tail = new_node(node->next());
+        node->setNext(tail);
+        node->move_tail(pos.index_ + 1, *tail);
+    }
+
+    NodeBase *after = before->next();
+    before->setNext(other.head_.next());
+    other.last_node()->setNext(after);
+    other.head_.setNext(nullptr);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::splice_after(
+        const_iterator pos,
+        UnrolledForwardList &other,
+        const_iterator it)
+{
+    iterator source(it.node_, it.index_);
+    ++source;
+
+    emplace_after(pos, std::move(*source));
+    other.erase_after(it);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::splice_after(
+        const_iterator pos,
+        UnrolledForwardList &other,
+        const_iterator first,
+        const_iterator last)
+{
+    if(first == last) {
+        return;
+    }
+
+    difference_type count = std::distance(first, last) - 1;
+    iterator dest(pos.node_, pos.index_);
+    iterator source(first.node_, first.index_);
+
+    for(; count > 0; --count) {
+        dest = emplace_after(dest, std::move(*std::next(source)));
+        other.erase_after(source);
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::size_type
+UnrolledForwardList<T, N, Alloc>::remove(const T& value) {
+    return remove_if([&value](const T& element) {
+            return element == value;
+            });
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::size_type
+UnrolledForwardList<T, N, Alloc>::remove_if(std::predicate<T> auto pred) {
+    return compact([&pred](const T &value, const T *) {
+            return pred(value);
+            });
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::reverse() {
+    Node *prev = nullptr;
+    Node *curr = head_.next();
+
+    while(curr != nullptr) {
+        Node *temp = curr->next();
+
+        for(std::size_t i = 0, j = curr->size() - 1; i < j; ++i, --j) {
+            std::swap(curr->value(i), curr->value(j));
+        }
+
+        curr->setNext(prev);
+        prev = curr;
+        curr = temp;
+    }
+
+    head_.setNext(prev);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::size_type
+UnrolledForwardList<T, N, Alloc>::unique() {
+    return unique(std::equal_to<T>{});
+}
+
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::size_type
+UnrolledForwardList<T, N, Alloc>::unique(detail::compare<T> auto pred) {
+    return compact([&pred](const T &value, const T *last_kept) {
+            return last_kept != nullptr && pred(*last_kept, value);
+            });
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::sort() {
+    sort(std::less<T>{});
+}
+
+//the elements are sorted in a contiguous buffer and moved back,
+//the nodes stay where they are
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::sort(detail::compare<T> auto comp) {
+    std::vector<T> buffer = take_elements(std::distance(begin(), end()));
+
+    try {
+        std::stable_sort(buffer.begin(), buffer.end(), comp);
+    } catch(...) {
+        refill(buffer);
+        throw;
+    }
+
+    refill(buffer);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::assign(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    iterator dest = before_begin();
+
+    for(; first != last && std::next(dest) != end(); ++first, ++dest) {
+        *std::next(dest) = *first;
+    }
+
+    if(first == last) {
+        truncate_after(dest);
+    } else {
+        insert_after(dest, first, last);
+    }
+}
+
+//returns the position of a new unconstructed slot after pos,
+//splits a full node in halves to make room
+template <typename T, std::size_t N, typename Alloc>
+typename UnrolledForwardList<T, N, Alloc>::iterator
+UnrolledForwardList<T, N, Alloc>::open_after(const_iterator pos) {
+    Node *node;
+    std::size_t index;
+
+    if(pos.is_before_first()) {
+        node = pos.node_->next();
+        index = 0;
+
+        if(node == nullptr || node->full()) {
+            node = new_node(pos.node_->next());
+            pos.node_->setNext(node);
+        }
+    } else {
+        node = pos.node();
+        index = pos.index_ + 1;
+
+        if(node->full()) {
+            Node *next = node->next();
+
+            if(index == N && next != nullptr && !next->full()) {
+                node = next;
+                index = 0;
+            } else {
+                Node *created = new_node(next);
+                node->setNext(created);
+
+                if(index == N) {
+                    node = created;
+                    index = 0;
+                } else {
+                    node->move_tail(N / 2, *created);
+
+                    if(index > N / 2) {
+                        node = created;
+                        index -= N / 2;
+                    }
+                }
+            }
+        }
+    }
+
+    node->open(index);
+    return iterator(node, index);
+}
+
+//destroys every element after pos
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::truncate_after(const_iterator pos) {
+    NodeBase *last = pos.node_;
+
+    if(!pos.is_before_first()) {
+        Node *node = pos.node();
+
+        for(std::size_t i = pos.index_ + 1; i < node->size(); ++i) {
+            NodeTraits::destroy(alloc_, node->slot(i));
+        }
+
+        node->setSize(pos.index_ + 1);
+    }
+
+    delete_chain(last->next());
+    last->setNext(nullptr);
+}
+
+//read and write cursors walk the list together,
+//the slots between them are always destroyed
+template <typename T, std::size_t N, typename Alloc>
+UnrolledForwardList<T, N, Alloc>::size_type
+UnrolledForwardList<T, N, Alloc>::compact(auto remove) {
+    Node *write = head_.next();
+    std::size_t write_index = 0;
+    const T *last_kept = nullptr;
+    size_type removed = 0;
+    std::exception_ptr error;
+
+    for(Node *read = head_.next(); read != nullptr;) {
+        Node *read_next = read->next();
+        std::size_t read_size = read->size();
+
+        for(std::size_t i = 0; i < read_size; ++i) {
+            T &value = read->value(i);
+            bool erase = false;
+
+            //after a throwing predicate the rest of the list is kept
+            if(!error) {
+                try {
+                    erase = remove(std::as_const(value), last_kept);
+                } catch(...) {
+                    error = std::current_exception();
+                }
+            }
+
+            if(erase) {
+                NodeTraits::destroy(alloc_, &value);
+                ++removed;
+                continue;
+            }
+
+            if(write_index == N) {
+                write->setSize(N);
+                write = write->next();
+                write_index = 0;
+            }
+
+            if(write != read || write_index != i) {
+                NodeTraits::construct(alloc_, write->slot(write_index),
+                        std::move(value));
+                NodeTraits::destroy(alloc_, &value);
+            }
+
+            last_kept = &write->value(write_index++);
+        }
+
+        read = read_next;
+    }
+
+    if(write_index == 0) {
+        //nothing was kept, every slot is already destroyed
+        for(Node *node = head_.next(); node != nullptr;) {
+            Node *next = node->next();
+            delete_node(node);
+            node = next;
+        }
+
+        head_.setNext(nullptr);
+    } else {
+        write->setSize(write_index);
+
+        for(Node *node = write->next(); node != nullptr;) {
+            Node *next = node->next();
+            delete_node(node);
+            node = next;
+        }
+
+        write->setNext(nullptr);
+    }
+
+    if(error) {
+        std::rethrow_exception(error);
+    }
+
+    return removed;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::refill(std::vector<T> &buffer) {
+    auto source = buffer.begin();
+
+    for(Node *node = head_.next(); node != nullptr; node = node->next()) {
+        for(std::size_t i = 0; i < node->size(); ++i, ++source) {
+            node->value(i) = std::move(*source);
+        }
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc>
+std::vector<T> UnrolledForwardList<T, N, Alloc>::take_elements(
+        size_type reserve)
+{
+    std::vector<T> buffer;
+    buffer.reserve(reserve);
+    buffer.insert(buffer.end(),
+            std::move_iterator(begin()),
+            std::move_iterator(end()));
+    return buffer;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+typename UnrolledForwardList<T, N, Alloc>::NodeBase *
+UnrolledForwardList<T, N, Alloc>::last_node() {
+    NodeBase *node = &head_;
+
+    while(node->next() != nullptr) {
+        node = node->next();
+    }
+
+    return node;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+typename UnrolledForwardList<T, N, Alloc>::Node *
+UnrolledForwardList<T, N, Alloc>::new_node(NodeBase *next) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+    NodeTraits::construct(alloc_, node, next);
+    return node;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::delete_node(Node *node) {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void UnrolledForwardList<T, N, Alloc>::delete_chain(Node *node) {
+    while(node != nullptr) {
+        Node *next = node->next();
+
+        for(std::size_t i = 0; i < node->size(); ++i) {
+            NodeTraits::destroy(alloc_, node->slot(i));
+        }
+
+        delete_node(node);
+        node = next;
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool operator == (
+        const UnrolledForwardList<T, N, Alloc> &lhs,
+        const UnrolledForwardList<T, N, Alloc> &rhs)
+{
+    if(std::addressof(lhs) == std::addressof(rhs)) {
+        return true;
+    }
+
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool operator != (
+        const UnrolledForwardList<T, N, Alloc> &lhs,
+        const UnrolledForwardList<T, N, Alloc> &rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+auto operator <=> (
+        const UnrolledForwardList<T, N, Alloc> &lhs,
+        const UnrolledForwardList<T, N, Alloc> &rhs)
+{
+    return std::lexicographical_compare_three_way(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end()
+        );
+}
+
+} //end namespace mystd
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <unistd.h>
+
+namespace mystd {
+
+// Buffered binary output to a std::ostream or a file descriptor. The bytes
+// are written in frames of at most buffer_size bytes, each led by its
+// length, so that a BinaryReader never reads past the data of one writer.
+// Nothing is written before flush() or a full buffer, the destructor
+// doesn't flush.
+class BinaryWriter {
+public:
+    static constexpr std::size_t buffer_size = 1 << 16;
+
+    explicit BinaryWriter(std::ostream &out) : out_(&out) {}
+    explicit BinaryWriter(int fd) : fd_(fd) {}
+
+    BinaryWriter(const BinaryWriter &) = delete;
+    BinaryWriter &operator = (const BinaryWriter &) = delete;
+
+    void write(const void *data, std::size_t size);
+
+    template <typename U>
+        requires std::is_trivially_copyable_v<U>
+    void write_value(const U &value) { write(&value, sizeof(U)); }
+
+    // writes the buffered bytes as one frame
+    void flush();
+
+private:
+    void write_out(const std::byte *data, std::size_t size);
+
+    std::vector<std::byte> buffer_ = std::vector<std::byte>(buffer_size);
+    std::size_t used_ = 0;
+    std::ostream *out_ = nullptr;
+    int fd_ = -1;
+};
+
+// Reads what a BinaryWriter wrote, one frame at a time, and never more.
+// Throws std::runtime_error if the input ends early.
+class BinaryReader {
+public:
+    explicit BinaryReader(std::istream &in) : in_(&in) {}
+    explicit BinaryReader(int fd) : fd_(fd) {}
+
+    BinaryReader(const BinaryReader &) = delete;
+    BinaryReader &operator = (const BinaryReader &) = delete;
+
+    void read(void *data, std::size_t size);
+
+    template <typename U>
+        requires std::is_trivially_copyable_v<U>
+    U read_value();
+
+private:
+    void next_frame();
+    void read_in(std::byte *data, std::size_t size);
+
+    std::vector<std::byte> buffer_;
+    std::size_t begin_ = 0;
+    std::istream *in_ = nullptr;
+    int fd_ = -1;
+};
+
+inline void BinaryWriter::write(const void *data, std::size_t size) {
+    if(size <= buffer_size - used_) {
+        std::memcpy(buffer_.data() + used_, data, size);
+        used_ += size;
+        return;
+    }
+
+    const auto *bytes = static_cast<const std::byte *>(data);
+
+    while(size > 0) {
+        if(used_ == buffer_size) {
+            flush();
+        }
+
+        std::size_t count = std::min(size, buffer_size - used_);
+        std::memcpy(buffer_.data() + used_, bytes, count);
+        used_ += count;
+        bytes += count;
+        size -= count;
+    }
+}
+
+inline void BinaryWriter::flush() {
+    if(used_ == 0) {
+        return;
+    }
+
+    auto length = static_cast<std::uint32_t>(used_);
+    write_out(reinterpret_cast<const std::byte *>(&length), sizeof(length));
+    write_out(buffer_.data(), used_);
+    used_ = 0;
+
+    if(out_ != nullptr) {
+        out_->flush();
+    }
+}
+
+inline void BinaryWriter::write_out(const std::byte *data, std::size_t size) {
+    if(out_ != nullptr) {
+        out_->write(reinterpret_cast<const char *>(data),
+                static_cast<std::streamsize>(size));
+
+        if(!*out_) {
+            throw std::ios_base::failure("BinaryWriter: write failed");
+        }
+
+        return;
+    }
+
+    while(size > 0) {
+        ssize_t written = ::write(fd_, data, size);
+
+        if(written == -1) {
+            if(errno == EINTR) {
+                continue;
+            }
+
+            throw std::system_error(errno, std::generic_category(),
+                    "BinaryWriter: write");
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+inline void BinaryReader::read(void *data, std::size_t size) {
+    if(size <= buffer_.size() - begin_) {
+        std::memcpy(data, buffer_.data() + begin_, size);
+        begin_ += size;
+        return;
+    }
+
+    auto *bytes = static_cast<std::byte *>(data);
+
+    while(size > 0) {
+        if(begin_ == buffer_.size()) {
+            next_frame();
+        }
+
+        std::size_t count = std::min(size, buffer_.size() - begin_);
+        std::memcpy(bytes, buffer_.data() + begin_, count);
+        begin_ += count;
+        bytes += count;
+        size -= count;
+    }
+}
+
+template <typename U>
+    requires std::is_trivially_copyable_v<U>
+U BinaryReader::read_value() {
+    std::array<std::byte, sizeof(U)> bytes;
+    read(bytes.data(), bytes.size());
+    return std::bit_cast<U>(bytes);
+}
+
+inline void BinaryReader::next_frame() {
+    std::uint32_t length = 0;
+    read_in(reinterpret_cast<std::byte *>(&length), sizeof(length));
+
+    if(length == 0 || length > BinaryWriter::buffer_size) {
+        throw std::runtime_error("BinaryReader: corrupt frame");
+    }
+
+    buffer_.resize(length);
+    read_in(buffer_.data(), length);
+    begin_ = 0;
+}
+
+inline void BinaryReader::read_in(std::byte *data, std::size_t size) {
+    if(in_ != nullptr) {
+        in_->read(reinterpret_cast<char *>(data),
+                static_cast<std::streamsize>(size));
+
+        if(static_cast<std::size_t>(in_->gcount()) != size) {
+            throw std::runtime_error("BinaryReader: unexpected end of input");
+        }
+
+        return;
+    }
+
+    while(size > 0) {
+        ssize_t count = ::read(fd_, data, size);
+
+        if(count == -1) {
+            if(errno == EINTR) {
+                continue;
+            }
+
+            throw std::system_error(errno, std::generic_category(),
+                    "BinaryReader: read");
+        }
+
+        if(count == 0) {
+            throw std::runtime_error("BinaryReader: unexpected end of input");
+        }
+
+        data += count;
+        size -= static_cast<std::size_t>(count);
+    }
+}
+
+} //end namespace mystd
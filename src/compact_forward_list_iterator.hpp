@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "compact_forward_list_node.hpp"
+
+namespace mystd {
+
+template <typename T, typename Index, typename Allocator>
+class CompactForwardList;
+
+namespace detail {
+
+// Points to the index of a node in the arena of a list. The before-begin
+// iterator has the index before_first_index, the end iterator null_index.
+template <bool IsConst, typename T, typename Index>
+class CompactFwdListIterator {
+    template<typename, typename, typename Allocator>
+    friend class mystd::CompactForwardList;
+
+    friend class CompactFwdListIterator<true, T, Index>;
+
+    using conditional = std::conditional_t<IsConst, const T, T>;
+    using Links = CompactFwdListLinks<T, Index>;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = conditional *;
+    using reference = conditional &;
+    using iterator_category = typename std::forward_iterator_tag;
+
+    CompactFwdListIterator() : links_(nullptr), index_(null_index<Index>) {}
+
+    CompactFwdListIterator(
+            const CompactFwdListIterator<false, T, Index> &iterator)
+        : links_(iterator.links_), index_(iterator.index_) {}
+
+    CompactFwdListIterator &operator = (
+            const CompactFwdListIterator &iterator) = default;
+
+    CompactFwdListIterator &operator ++ ();
+    CompactFwdListIterator operator ++ (int);
+    reference operator * () const;
+    pointer operator -> () const;
+
+    bool operator == (const CompactFwdListIterator &rhs) const = default;
+
+private:
+    CompactFwdListIterator(Links *links, Index index)
+        : links_(links), index_(index) {}
+
+    Index next() const { return links_->next(index_); }
+
+    Links *links_;
+    Index index_;
+};
+
+template <bool IsConst, typename T, typename Index>
+CompactFwdListIterator<IsConst, T, Index> &
+CompactFwdListIterator<IsConst, T, Index>::operator ++ () {
+    index_ = next();
+    return *this;
+}
+
+template <bool IsConst, typename T, typename Index>
+CompactFwdListIterator<IsConst, T, Index>
+CompactFwdListIterator<IsConst, T, Index>::operator ++ (int) {
+    auto copy = *this;
+    index_ = next();
+    return copy;
+}
+
+template <bool IsConst, typename T, typename Index>
+typename CompactFwdListIterator<IsConst, T, Index>::reference
+    CompactFwdListIterator<IsConst, T, Index>::operator * () const
+{
+    return links_->nodes[index_].value();
+}
+
+template <bool IsConst, typename T, typename Index>
+typename CompactFwdListIterator<IsConst, T, Index>::pointer
+    CompactFwdListIterator<IsConst, T, Index>::operator -> () const
+{
+    return std::addressof(links_->nodes[index_].value());
+}
+
+} //end namespace detail
+} //end namespace mystd
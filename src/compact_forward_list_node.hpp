@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace mystd {
+namespace detail {
+
+// index that links to no node, it ends the list and the free list
+template <typename Index>
+inline constexpr Index null_index = std::numeric_limits<Index>::max();
+
+// index of the position before the first node, the link of the list head
+template <typename Index>
+inline constexpr Index before_first_index = null_index<Index> - 1;
+
+// Slot of the arena of CompactForwardList. The element storage holds a
+// constructed element only while the slot is linked into the list, a free
+// slot uses its link for the free list. The slot does not destroy the
+// element itself.
+template <typename T, typename Index>
+struct CompactFwdListNode {
+    static_assert(std::is_unsigned_v<Index>, "links must be unsigned indices");
+
+    Index next() const { return next_; }
+    void setNext(Index next) { next_ = next; }
+
+    T *slot() { return reinterpret_cast<T *>(storage_); }
+
+    T &value() { return *std::launder(slot()); }
+    const T &value() const {
+        return const_cast<CompactFwdListNode *>(this)->value();
+    }
+
+private:
+    Index next_;
+    alignas(T) std::byte storage_[sizeof(T)];
+};
+
+// The arena and the link to the first node. The iterators point to it, so
+// they stay valid while the arena is reallocated.
+template <typename T, typename Index>
+struct CompactFwdListLinks {
+    using Node = CompactFwdListNode<T, Index>;
+
+    Index next(Index pos) const {
+        return pos == before_first_index<Index> ? head : nodes[pos].next();
+    }
+
+    void setNext(Index pos, Index next) {
+        if(pos == before_first_index<Index>) {
+            head = next;
+        } else {
+            nodes[pos].setNext(next);
+        }
+    }
+
+    Node *nodes = nullptr;
+    Index head = null_index<Index>;
+};
+
+} //end namespace detail
+} //end namespace mystd
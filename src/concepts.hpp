@@ -1,6 +1,9 @@
 #pragma once 
 
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
 
 namespace mystd {
 namespace detail {
@@ -10,5 +13,21 @@ concept compare = requires (const T &lhs, const T &rhs, Compare comp) {
     { comp(lhs, rhs) } -> std::convertible_to<bool>;
 };
 
+// maps an element to an integer, the key of a radix sort or the index
+// of a partition
+template<typename Key, typename T>
+concept key_extractor = std::invocable<Key &, const T &> &&
+    std::integral<std::remove_cvref_t<std::invoke_result_t<Key &, const T &>>>
+    && !std::same_as<
+        std::remove_cvref_t<std::invoke_result_t<Key &, const T &>>, bool>;
+
+// allocator that can hand out several adjacent objects at once, each of
+// them is deallocated on its own
+template<typename Alloc>
+concept contiguous_allocator = requires (Alloc alloc, std::size_t n) {
+    { alloc.allocate_contiguous(n) }
+        -> std::same_as<typename Alloc::value_type *>;
+};
+
 } //end namespace mystd
 } //end namespace detail
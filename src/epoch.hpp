@@ -0,0 +1,187 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+namespace mystd {
+namespace detail {
+
+// Process-wide epoch based reclamation for the concurrent containers.
+//
+// A thread reads shared nodes only inside a critical section (EpochGuard).
+// On entry it announces the global epoch it has seen. A node that was
+// unlinked before the global epoch was advanced to E can no longer be
+// reached by a thread that announced E or later, so it may be freed once
+// every thread inside a critical section has announced at least E.
+class EpochDomain {
+public:
+    // no epoch is announced outside of a critical section
+    static constexpr std::uint64_t quiescent = 0;
+
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain &operator = (const EpochDomain &) = delete;
+
+    // thread records may be released by thread_local destructors that run
+    // after the static ones, so the domain is intentionally never destroyed
+    static EpochDomain &instance() {
+        static EpochDomain *domain = new EpochDomain();
+        return *domain;
+    }
+
+    void enter();
+    void leave();
+
+    // starts a new epoch and returns it, nodes unlinked before the call
+    // can be freed when min_active() reaches the returned value
+    std::uint64_t advance();
+
+    // the oldest epoch announced by a thread inside a critical section,
+    // or the maximal value if there is no such thread
+    std::uint64_t min_active() const;
+
+    // waits until every critical section that was entered before the call
+    // is left, must not be called inside a critical section
+    void synchronize();
+
+private:
+    struct alignas(64) ThreadRecord {
+        std::atomic<std::uint64_t> epoch{quiescent};
+        std::atomic<bool> in_use{true};
+        ThreadRecord *next = nullptr;
+        unsigned depth = 0;
+    };
+
+    struct RecordOwner {
+        ~RecordOwner();
+
+        ThreadRecord *record = nullptr;
+    };
+
+    EpochDomain() = default;
+
+    ThreadRecord &thread_record();
+    ThreadRecord *acquire_record();
+
+    std::atomic<std::uint64_t> epoch_{1};
+    // records are never freed, records of finished threads are reused
+    std::atomic<ThreadRecord *> records_{nullptr};
+};
+
+// Keeps the calling thread inside a critical section of the epoch domain
+class EpochGuard {
+public:
+    EpochGuard() { EpochDomain::instance().enter(); }
+    ~EpochGuard() { EpochDomain::instance().leave(); }
+
+    EpochGuard(const EpochGuard &) = delete;
+    EpochGuard &operator = (const EpochGuard &) = delete;
+};
+
+inline void EpochDomain::enter() {
+    ThreadRecord &record = thread_record();
+
+    if(record.depth++ > 0) {
+        return;
+    }
+
+    record.epoch.store(epoch_.load(std::memory_order_acquire),
+            std::memory_order_relaxed);
+    // the announcement must be visible before any shared node is read
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void EpochDomain::leave() {
+    ThreadRecord &record = thread_record();
+
+    if(--record.depth == 0) {
+        record.epoch.store(quiescent, std::memory_order_release);
+    }
+}
+
+inline std::uint64_t EpochDomain::advance() {
+    return epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+}
+
+inline std::uint64_t EpochDomain::min_active() const {
+    // pairs with the fence in enter(), either the announcement is seen here
+    // or the announcing thread sees the nodes already unlinked
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::uint64_t min = std::numeric_limits<std::uint64_t>::max();
+    for(ThreadRecord *record = records_.load(std::memory_order_acquire);
+            record != nullptr; record = record->next)
+    {
+        std::uint64_t epoch = record->epoch.load(std::memory_order_acquire);
+
+        if(epoch != quiescent && epoch < min) {
+            min = epoch;
+        }
+    }
+
+    return min;
+}
+
+inline void EpochDomain::synchronize() {
+    std::uint64_t epoch = advance();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    for(ThreadRecord *record = records_.load(std::memory_order_acquire);
+            record != nullptr; record = record->next)
+    {
+        for(;;) {
+            std::uint64_t announced =
+                record->epoch.load(std::memory_order_acquire);
+
+            if(announced == quiescent || announced >= epoch) {
+                break;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+}
+
+inline EpochDomain::ThreadRecord &EpochDomain::thread_record() {
+    static thread_local RecordOwner owner;
+
+    if(owner.record == nullptr) {
+        owner.record = acquire_record();
+    }
+
+    return *owner.record;
+}
+
+inline EpochDomain::ThreadRecord *EpochDomain::acquire_record() {
+    for(ThreadRecord *record = records_.load(std::memory_order_acquire);
+            record != nullptr; record = record->next)
+    {
+        bool in_use = false;
+        if(!record->in_use.load(std::memory_order_relaxed)
+                && record->in_use.compare_exchange_strong(in_use, true,
+                    std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    auto *record = new ThreadRecord();
+    record->next = records_.load(std::memory_order_relaxed);
+
+    while(!records_.compare_exchange_weak(record->next, record,
+                std::memory_order_release, std::memory_order_relaxed));
+
+    return record;
+}
+
+inline EpochDomain::RecordOwner::~RecordOwner() {
+    if(record != nullptr) {
+        record->depth = 0;
+        record->epoch.store(quiescent, std::memory_order_relaxed);
+        record->in_use.store(false, std::memory_order_release);
+    }
+}
+
+} //end namespace detail
+} //end namespace mystd
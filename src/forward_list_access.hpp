@@ -0,0 +1,40 @@
+#pragma once
+
+#include <utility>
+
+namespace mystd {
+namespace detail {
+
+// Lets the other containers of the library hand whole node chains to a
+// ForwardList and take them back, without copying or reallocating nodes.
+// The nodes must come from an allocator equal to the one of the list.
+struct FwdListAccess {
+    // links the chain that starts with first into the empty list
+    template <typename List, typename NodeBase>
+    static void adopt(List &list, NodeBase *first) {
+        list.adopt(first);
+    }
+
+    // unlinks all nodes of the list, returns the first and the last one
+    template <typename List>
+    static auto release(List &list) {
+        return list.release();
+    }
+
+    // unlinks all nodes of the list without looking for the last one,
+    // returns the first one
+    template <typename List>
+    static auto release_first(List &list) {
+        auto first = list.head_.next();
+        list.reset();
+        return first;
+    }
+
+    template <typename List>
+    static const auto &node_allocator(const List &list) {
+        return list.alloc_;
+    }
+};
+
+} //end namespace detail
+} //end namespace mystd
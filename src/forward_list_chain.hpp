@@ -0,0 +1,568 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mystd {
+namespace detail {
+
+// Algorithms over null-terminated chains of singly linked nodes. NodeBase is
+// any node type with next() and setNext(), less compares two nodes.
+
+template <typename NodeBase>
+NodeBase *last_node(NodeBase *node) {
+    while(node->next() != nullptr) {
+        node = node->next();
+    }
+
+    return node;
+}
+
+// Cuts the chain after count nodes, returns the first node of the rest.
+template <typename NodeBase>
+NodeBase *split_chain(NodeBase *first, std::size_t count) {
+    if(first == nullptr) {
+        return nullptr;
+    }
+
+    for(; count > 1 && first->next() != nullptr; --count) {
+        first = first->next();
+    }
+
+    NodeBase *rest = first->next();
+    first->setNext(nullptr);
+    return rest;
+}
+
+// Links the stable merge of two sorted chains after tail and returns the last
+// node of the result. If less throws, both chains are still linked after tail.
+template <typename NodeBase, typename Less>
+NodeBase *merge_chains(NodeBase *tail,
+        NodeBase *first,
+        NodeBase *second,
+        Less &less)
+{
+    try {
+        while(first != nullptr && second != nullptr) {
+            if(less(second, first)) {
+                tail->setNext(second);
+                second = second->next();
+            } else {
+                tail->setNext(first);
+                first = first->next();
+            }
+
+            tail = tail->next();
+        }
+    } catch(...) {
+        tail->setNext(first);
+        last_node(tail)->setNext(second);
+        throw;
+    }
+
+    tail->setNext(first != nullptr ? first : second);
+    return last_node(tail);
+}
+
+// Links the stable merge of the sorted chains that start with firsts after
+// tail and returns the last node of the result. Neighbouring chains are merged
+// pairwise in rounds, like the matches of a tournament, so every node takes
+// part in log k merges of two chains: O(n log k) comparisons that walk two
+// chains at a time. Equal nodes are ordered by the position of their chain in
+// firsts. The span is used as scratch space. If less throws, all nodes are
+// still linked after tail.
+template <typename NodeBase, typename Less>
+NodeBase *merge_all_chains(NodeBase *tail,
+        std::span<NodeBase *> firsts,
+        Less &less)
+{
+    NodeBase *last = nullptr;
+
+    try {
+        for(std::size_t step = 1; step < firsts.size(); step *= 2) {
+            for(std::size_t i = 0; i + step < firsts.size(); i += 2 * step) {
+                NodeBase head;
+                NodeBase *second = std::exchange(firsts[i + step], nullptr);
+
+                try {
+                    last = merge_chains(&head, firsts[i], second, less);
+                } catch(...) {
+                    firsts[i] = head.next();
+                    throw;
+                }
+
+                firsts[i] = head.next();
+            }
+        }
+    } catch(...) {
+        for(NodeBase *first : firsts) {
+            if(first != nullptr) {
+                tail->setNext(first);
+                tail = last_node(tail);
+            }
+        }
+
+        throw;
+    }
+
+    if(firsts.empty() || firsts.front() == nullptr) {
+        tail->setNext(nullptr);
+        return tail;
+    }
+
+    //the last merge of the final round made the chain that is left
+    tail->setNext(firsts.front());
+    return firsts.size() > 1 ? last : last_node(tail);
+}
+
+// Non-recursive bottom-up merge sort of the chain that follows head. Every
+// pass merges neighbouring runs of the same width in place, so the sort is
+// stable and uses O(1) extra space. Returns the last node of the sorted chain.
+template <typename NodeBase, typename Less>
+NodeBase *sort_chain(NodeBase *head, Less less) {
+    for(std::size_t width = 1;; width *= 2) {
+        NodeBase *tail = head;
+        NodeBase *first = head->next();
+        std::size_t merges = 0;
+
+        while(first != nullptr) {
+            NodeBase *second = first;
+            std::size_t first_size = 0;
+            std::size_t second_size = width;
+
+            for(; first_size < width && second != nullptr; ++first_size) {
+                second = second->next();
+            }
+
+            try {
+                while(first_size > 0 || (second_size > 0 && second)) {
+                    if(first_size == 0 || (second_size > 0 && second 
+                                && less(second, first))) {
+                        tail->setNext(second);
+                        second = second->next();
+                        --second_size;
+                    } else {
+                        tail->setNext(first);
+                        first = first->next();
+                        --first_size;
+                    }
+
+                    tail = tail->next();
+                }
+            } catch(...) {
+                // the untaken nodes of both runs are still linked in their
+                // original order, relink them after tail
+                if(first_size == 0) {
+                    tail->setNext(second);
+                    throw;
+                }
+
+                tail->setNext(first);
+                while(--first_size > 0) {
+                    first = first->next();
+                }
+                first->setNext(second);
+                throw;
+            }
+
+            first = second;
+            ++merges;
+        }
+
+        tail->setNext(nullptr);
+
+        if(merges <= 1) {
+            return tail;
+        }
+    }
+}
+
+// Sorts the chain that follows head by gathering its nodes into a contiguous
+// buffer, sorting the buffer and relinking the nodes in one pass. Small
+// trivially copyable values are copied next to their node pointers, so the
+// comparisons never leave the buffer. value maps a node to its element.
+// The chain is left untouched if comp or an allocation throws.
+template <typename NodeBase, typename Value, typename Compare>
+NodeBase *gather_sort_chain(NodeBase *head, Value value, Compare &comp) {
+    using T = std::remove_cvref_t<decltype(value(head))>;
+
+    constexpr bool copy_keys = std::is_trivially_copyable_v<T>
+        && sizeof(T) <= 2 * sizeof(void *);
+
+    NodeBase *tail = head;
+
+    if constexpr(copy_keys) {
+        std::vector<std::pair<T, NodeBase *>> entries;
+        for(NodeBase *node = head->next(); node != nullptr; node = node->next()) {
+            entries.emplace_back(value(node), node);
+        }
+
+        std::stable_sort(entries.begin(), entries.end(), 
+            [&comp](const auto &lhs, const auto &rhs) {
+                return comp(lhs.first, rhs.first);
+            });
+
+        for(auto &entry : entries) {
+            tail->setNext(entry.second);
+            tail = entry.second;
+        }
+    } else {
+        std::vector<NodeBase *> nodes;
+        for(NodeBase *node = head->next(); node != nullptr; node = node->next()) {
+            nodes.push_back(node);
+        }
+
+        std::stable_sort(nodes.begin(), nodes.end(), 
+            [&comp, &value](NodeBase *lhs, NodeBase *rhs) {
+                return comp(value(lhs), value(rhs));
+            });
+
+        for(NodeBase *node : nodes) {
+            tail->setNext(node);
+            tail = node;
+        }
+    }
+
+    tail->setNext(nullptr);
+    return tail;
+}
+
+// Stable LSD radix sort of the chain that follows head, key maps a node to
+// an unsigned integer. Every pass distributes the nodes into bucket chains by
+// one digit of their keys and links the buckets back one after another,
+// digits that are the same in all keys are skipped. Long chains take wider
+// digits and fewer passes, as each pass costs a cache miss per node, short
+// ones are merge sorted by key. Returns the last node of the sorted chain.
+// If key throws, all nodes stay linked after head.
+template <typename NodeBase, typename Key>
+NodeBase *radix_sort_chain(NodeBase *head, Key key) {
+    using Bits = std::remove_cvref_t<decltype(key(head))>;
+    static_assert(std::unsigned_integral<Bits>);
+
+    constexpr std::size_t merge_sort_threshold = 512;
+    constexpr std::size_t wide_digits_threshold = std::size_t{1} << 16;
+    constexpr std::size_t max_bucket_count = std::size_t{1} << 11;
+
+    if(head->next() == nullptr) {
+        return head;
+    }
+
+    NodeBase *tail = head;
+    Bits first = key(head->next());
+    Bits differ = 0;
+    std::size_t count = 0;
+
+    for(NodeBase *node = head->next(); node != nullptr; node = node->next()) {
+        differ |= static_cast<Bits>(key(node) ^ first);
+        tail = node;
+        ++count;
+    }
+
+    if(count < merge_sort_threshold) {
+        return sort_chain(head, [&key](NodeBase *lhs, NodeBase *rhs) {
+                return key(lhs) < key(rhs);
+            });
+    }
+
+    std::size_t digit_bits = count < wide_digits_threshold ? 8 : 11;
+    std::size_t bucket_count = std::size_t{1} << digit_bits;
+
+    std::array<NodeBase, max_bucket_count> buckets;
+    std::array<NodeBase *, max_bucket_count> tails;
+
+    //links the buckets in order after head, returns the last node
+    auto gather = [head, bucket_count, &buckets, &tails]() {
+        NodeBase *last = head;
+
+        for(std::size_t i = 0; i < bucket_count; ++i) {
+            if(tails[i] != &buckets[i]) {
+                last->setNext(buckets[i].next());
+                last = tails[i];
+            }
+        }
+
+        return last;
+    };
+
+    for(std::size_t shift = 0; shift < std::numeric_limits<Bits>::digits;
+            shift += digit_bits)
+    {
+        if(((differ >> shift) & (bucket_count - 1)) == 0) {
+            continue;
+        }
+
+        for(std::size_t i = 0; i < bucket_count; ++i) {
+            tails[i] = &buckets[i];
+        }
+
+        NodeBase *node = head->next();
+
+        try {
+            for(; node != nullptr; node = node->next()) {
+                auto bucket = (key(node) >> shift) & (bucket_count - 1);
+                tails[bucket]->setNext(node);
+                tails[bucket] = node;
+            }
+        } catch(...) {
+            gather()->setNext(node);
+            throw;
+        }
+
+        tail = gather();
+        tail->setNext(nullptr);
+    }
+
+    return tail;
+}
+
+// Moves the k smallest nodes of the chain that follows head to its front in
+// sorted order, the other nodes follow in their original order. One walk over
+// the chain keeps a heap of the k best nodes seen so far, so it takes
+// O(n log k) comparisons and O(k) extra space. Equal nodes keep their order.
+// Returns the last node of the chain, which is left untouched if less or an
+// allocation throws.
+template <typename NodeBase, typename Less>
+NodeBase *partial_sort_chain(NodeBase *head, std::size_t k, Less less) {
+    using Entry = std::pair<NodeBase *, std::size_t>;
+
+    //nodes that compare equal are ordered by their position
+    auto before = [&less](const Entry &lhs, const Entry &rhs) {
+        if(less(lhs.first, rhs.first)) {
+            return true;
+        }
+
+        if(less(rhs.first, lhs.first)) {
+            return false;
+        }
+
+        return lhs.second < rhs.second;
+    };
+
+    if(k == 0) {
+        return last_node(head);
+    }
+
+    std::vector<Entry> heap;
+    std::size_t count = 0;
+
+    for(NodeBase *node = head->next(); node != nullptr;
+            node = node->next(), ++count)
+    {
+        Entry entry{node, count};
+
+        if(heap.size() < k) {
+            heap.push_back(entry);
+            std::push_heap(heap.begin(), heap.end(), before);
+        } else if(before(entry, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), before);
+            heap.back() = entry;
+            std::push_heap(heap.begin(), heap.end(), before);
+        }
+    }
+
+    if(heap.size() == count) {
+        return sort_chain(head, less);
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), before);
+
+    std::vector<std::size_t> chosen(heap.size());
+    std::transform(heap.begin(), heap.end(), chosen.begin(),
+            [](const Entry &entry) { return entry.second; });
+    std::sort(chosen.begin(), chosen.end());
+
+    //the nodes that were not chosen keep their order behind the chosen ones
+    NodeBase rest;
+    NodeBase *rest_tail = &rest;
+    auto next_chosen = chosen.begin();
+    std::size_t position = 0;
+
+    for(NodeBase *node = head->next(); node != nullptr;
+            node = node->next(), ++position)
+    {
+        if(next_chosen != chosen.end() && *next_chosen == position) {
+            ++next_chosen;
+        } else {
+            rest_tail->setNext(node);
+            rest_tail = node;
+        }
+    }
+
+    rest_tail->setNext(nullptr);
+
+    NodeBase *tail = head;
+
+    for(const Entry &entry : heap) {
+        tail->setNext(entry.first);
+        tail = entry.first;
+    }
+
+    tail->setNext(rest.next());
+    return rest_tail;
+}
+
+template <typename NodeBase, typename Less>
+NodeBase *median_node(NodeBase *a, NodeBase *b, NodeBase *c, Less &less) {
+    if(less(a, b)) {
+        if(less(b, c)) {
+            return b;
+        }
+
+        return less(a, c) ? c : a;
+    }
+
+    if(less(a, c)) {
+        return a;
+    }
+
+    return less(b, c) ? c : b;
+}
+
+// Relinks the chain that follows head so that its node at position n is the
+// one a full sort would put there, no node before it is greater and no node
+// after it is less. Quickselect that splits the nodes into three chains
+// around a median of three pivot and goes on with the chain that holds
+// position n. Patterned input can defeat the median of three, so like
+// introselect it merge sorts the part that is left once 2 log n rounds are
+// used up: O(n) comparisons on typical input, O(n log n) at worst.
+// Equal nodes keep their order.
+// Returns the nth node, or nullptr if the chain is shorter, and the last
+// node of the chain. If less throws, all nodes stay linked after head.
+template <typename NodeBase, typename Less>
+std::pair<NodeBase *, NodeBase *> select_chain(NodeBase *head, std::size_t n,
+        Less less)
+{
+    std::size_t count = 0;
+    NodeBase *last = head;
+
+    for(NodeBase *node = head->next(); node != nullptr; node = node->next()) {
+        last = node;
+        ++count;
+    }
+
+    if(n >= count) {
+        return {nullptr, last};
+    }
+
+    //the part left to select from is count nodes between before and after
+    NodeBase *before = head;
+    NodeBase *after = nullptr;
+    std::size_t rounds = 2 * std::bit_width(count);
+
+    while(count > 1) {
+        if(rounds-- == 0) {
+            NodeBase *end = before;
+
+            for(std::size_t i = 0; i < count; ++i) {
+                end = end->next();
+            }
+
+            end->setNext(nullptr);
+
+            try {
+                end = sort_chain(before, less);
+            } catch(...) {
+                last_node(before)->setNext(after);
+                throw;
+            }
+
+            end->setNext(after);
+
+            if(after == nullptr) {
+                last = end;
+            }
+
+            NodeBase *nth = before->next();
+
+            for(; n > 0; --n) {
+                nth = nth->next();
+            }
+
+            return {nth, last};
+        }
+
+        NodeBase *first = before->next();
+        NodeBase *middle = first;
+        NodeBase *back = first;
+
+        for(std::size_t i = 1; i < count; ++i) {
+            back = back->next();
+            middle = i % 2 == 0 ? middle->next() : middle;
+        }
+
+        NodeBase *pivot = median_node(first, middle, back, less);
+
+        std::array<NodeBase, 3> parts;
+        std::array<NodeBase *, 3> tails{&parts[0], &parts[1], &parts[2]};
+        std::array<std::size_t, 3> sizes{};
+
+        //links the parts in order between before and rest
+        auto gather = [&before, &parts, &tails](NodeBase *rest) {
+            NodeBase *tail = before;
+
+            for(std::size_t i = 0; i < parts.size(); ++i) {
+                if(tails[i] != &parts[i]) {
+                    tail->setNext(parts[i].next());
+                    tail = tails[i];
+                }
+            }
+
+            tail->setNext(rest);
+            return tail;
+        };
+
+        NodeBase *node = first;
+
+        try {
+            for(std::size_t i = 0; i < count; ++i) {
+                NodeBase *next = node->next();
+                std::size_t part = less(node, pivot) ? 0
+                    : less(pivot, node) ? 2 : 1;
+
+                tails[part]->setNext(node);
+                tails[part] = node;
+                ++sizes[part];
+                node = next;
+            }
+        } catch(...) {
+            gather(node);
+            throw;
+        }
+
+        NodeBase *tail = gather(after);
+
+        if(after == nullptr) {
+            last = tail;
+        }
+
+        if(n < sizes[0]) {
+            after = parts[1].next();
+            count = sizes[0];
+        } else if(n < sizes[0] + sizes[1]) {
+            NodeBase *nth = parts[1].next();
+
+            for(n -= sizes[0]; n > 0; --n) {
+                nth = nth->next();
+            }
+
+            return {nth, last};
+        } else {
+            before = tails[1];
+            n -= sizes[0] + sizes[1];
+            count = sizes[2];
+        }
+    }
+
+    return {before->next(), last};
+}
+
+} //end namespace detail
+} //end namespace mystd
@@ -4,14 +4,21 @@
 #include <iterator>
 
 #include "forward_list_node.hpp"
+#include "list_policy.hpp"
 
 namespace mystd {
 
-template <typename T, typename Allocator> 
+template <typename T, typename Allocator, list_policy Policy> 
 class ForwardList;
 
+template <typename K, typename Compare, typename Allocator>
+class SkipList;
+
 namespace detail {
 
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Allocator>
+class HashTable;
 
 template <typename T>
 struct FwdListNode : public FwdListNodeBase<T> {
@@ -40,9 +47,15 @@ private:
 
 template <bool IsConst, typename T>
 class FwdListIterator {
-    template<typename, typename Allocator>
+    template<typename, typename Allocator, list_policy>
     friend class mystd::ForwardList;
 
+    template<typename, typename, typename>
+    friend class mystd::SkipList;
+
+    template<typename, typename, typename, typename, typename>
+    friend class HashTable;
+
     friend class FwdListIterator<true, T>;
 
     using conditional = std::conditional_t<IsConst, const T, T>;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 namespace mystd {
 namespace detail {
 
@@ -16,6 +18,18 @@ struct FwdListNodeBase {
         return static_cast<FwdListNode<T> *>(next_); 
     }
 
+    // atomic access to the link for the concurrent containers, it must not 
+    // race with the plain accessors
+    FwdListNode<T> *loadNext(std::memory_order order) const {
+        auto link = std::atomic_ref<FwdListNodeBase *>(
+                const_cast<FwdListNodeBase *&>(next_));
+        return static_cast<FwdListNode<T> *>(link.load(order));
+    }
+
+    void storeNext(FwdListNodeBase *next, std::memory_order order) {
+        std::atomic_ref<FwdListNodeBase *>(next_).store(next, order);
+    }
+
 private:
     FwdListNodeBase<T> *next_;
 };
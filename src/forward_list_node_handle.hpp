@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "forward_list_node.hpp"
+#include "list_policy.hpp"
+
+namespace mystd {
+
+template <typename T, typename Allocator, list_policy Policy>
+class ForwardList;
+
+namespace detail {
+
+// Owns a node extracted from a ForwardList together with a copy of the
+// allocator it came from. The node is relinked by ForwardList::insert_after
+// or destroyed with the handle. Lists that differ only in the policy share
+// the handle type.
+template <typename T, typename Allocator>
+class FwdListNodeHandle {
+    template<typename, typename, list_policy>
+    friend class mystd::ForwardList;
+
+    using Node = FwdListNode<T>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    FwdListNodeHandle() = default;
+    FwdListNodeHandle(FwdListNodeHandle &&other) noexcept;
+    FwdListNodeHandle &operator = (FwdListNodeHandle &&other);
+    ~FwdListNodeHandle() { reset(); }
+
+    bool empty() const { return node_ == nullptr; }
+    explicit operator bool() const { return !empty(); }
+
+    value_type &value() const { return node_->value(); }
+    allocator_type get_allocator() const { return allocator_type(*alloc_); }
+
+    void swap(FwdListNodeHandle &other);
+
+private:
+    FwdListNodeHandle(Node *node, const NodeAlloc &alloc)
+        : node_(node), alloc_(alloc) {}
+
+    Node *release();
+    void reset();
+
+    Node *node_ = nullptr;
+    std::optional<NodeAlloc> alloc_;
+};
+
+template <typename T, typename Allocator>
+FwdListNodeHandle<T, Allocator>::FwdListNodeHandle(
+        FwdListNodeHandle &&other) noexcept
+    : node_(other.node_), alloc_(std::move(other.alloc_))
+{
+    other.node_ = nullptr;
+    other.alloc_.reset();
+}
+
+template <typename T, typename Allocator>
+FwdListNodeHandle<T, Allocator> &
+FwdListNodeHandle<T, Allocator>::operator = (FwdListNodeHandle &&other) {
+    if(this != std::addressof(other)) {
+        reset();
+        node_ = std::exchange(other.node_, nullptr);
+        alloc_ = std::move(other.alloc_);
+        other.alloc_.reset();
+    }
+
+    return *this;
+}
+
+template <typename T, typename Allocator>
+void FwdListNodeHandle<T, Allocator>::swap(FwdListNodeHandle &other) {
+    std::swap(node_, other.node_);
+    std::swap(alloc_, other.alloc_);
+}
+
+//gives up the ownership of the node, the handle becomes empty
+template <typename T, typename Allocator>
+typename FwdListNodeHandle<T, Allocator>::Node *
+FwdListNodeHandle<T, Allocator>::release() {
+    alloc_.reset();
+    return std::exchange(node_, nullptr);
+}
+
+template <typename T, typename Allocator>
+void FwdListNodeHandle<T, Allocator>::reset() {
+    if(node_ == nullptr) {
+        return;
+    }
+
+    NodeTraits::destroy(*alloc_, node_);
+    NodeTraits::deallocate(*alloc_, node_, 1);
+    node_ = nullptr;
+    alloc_.reset();
+}
+
+} //end namespace detail
+} //end namespace mystd
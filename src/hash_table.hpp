@@ -0,0 +1,781 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "forward_list_iterator.hpp"
+
+namespace mystd {
+namespace detail {
+
+// Node of a HashTable, a FwdListNode that keeps the hash of its key, so
+// lookups compare keys only on equal hashes and rehashing calls no hasher.
+template <typename Value>
+struct HashNode : public FwdListNode<Value> {
+    template <typename ...Args>
+    explicit HashNode(Args &&...args)
+        : FwdListNode<Value>(nullptr, std::forward<Args>(args)...) {}
+
+    std::size_t hash_ = 0;
+};
+
+struct IdentityKey {
+    template <typename Value>
+    const Value &operator () (const Value &value) const { return value; }
+};
+
+struct FirstKey {
+    template <typename Pair>
+    const auto &operator () (const Pair &pair) const { return pair.first; }
+};
+
+// Hash table with unique keys behind UnorderedSet and UnorderedMap. All
+// nodes form one forward list and the nodes of a bucket are adjacent in it.
+// A bucket points to the node before its first node, that is the head of
+// the list or the last node of another bucket, so erasing the first node
+// of a bucket takes no search and a traversal never visits empty buckets.
+// There is a power of two buckets, the cached hashes are mixed by a
+// multiplication before their top bits pick the bucket.
+//
+// Rehashing relinks the nodes into the new buckets without moving them, so
+// iterators and references stay valid. The nodes are allocated one at a
+// time, which suits NodePoolAllocator.
+//
+// KeyOf maps an element to its key, the elements of a set are their keys
+// and can't be changed through the iterators.
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Allocator>
+class HashTable {
+    static constexpr bool const_iterator_only =
+        std::is_same_v<KeyOf, IdentityKey>;
+
+protected:
+    using NodeBase = FwdListNodeBase<Value>;
+    using Node = HashNode<Value>;
+    using Traits = typename std::allocator_traits<Allocator>;
+    using NodeAlloc = typename Traits::template rebind_alloc<Node>;
+    using NodeTraits = typename std::allocator_traits<NodeAlloc>;
+    using BucketAlloc = typename Traits::template rebind_alloc<NodeBase *>;
+
+public:
+    using key_type = std::remove_cvref_t<
+        decltype(KeyOf{}(std::declval<const Value &>()))>;
+    using value_type = Value;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    using pointer = Traits::pointer;
+    using const_pointer = Traits::const_pointer;
+
+    using size_type = Traits::size_type;
+    using difference_type = Traits::difference_type;
+
+    using iterator = FwdListIterator<const_iterator_only, Value>;
+    using const_iterator = FwdListIterator<true, Value>;
+
+    // a table that holds elements has at least this many buckets
+    static constexpr size_type min_bucket_count = 8;
+
+    HashTable() : HashTable(0) {}
+
+    explicit HashTable(size_type bucket_count,
+            const Hash &hash = Hash{},
+            const KeyEqual &equal = KeyEqual{},
+            const Allocator &alloc = Allocator{});
+
+    explicit HashTable(const Allocator &alloc)
+        : HashTable(0, Hash{}, KeyEqual{}, alloc) {}
+
+    HashTable(std::input_iterator auto first,
+            std::input_iterator auto last,
+            size_type bucket_count = 0,
+            const Hash &hash = Hash{},
+            const KeyEqual &equal = KeyEqual{},
+            const Allocator &alloc = Allocator{});
+
+    HashTable(std::initializer_list<Value> ilist,
+            size_type bucket_count = 0,
+            const Hash &hash = Hash{},
+            const KeyEqual &equal = KeyEqual{},
+            const Allocator &alloc = Allocator{});
+
+    HashTable(const HashTable &other);
+    HashTable(HashTable &&other);
+
+    ~HashTable() { clear(); }
+
+    HashTable &operator = (const HashTable &other);
+    HashTable &operator = (HashTable &&other);
+    HashTable &operator = (std::initializer_list<Value> ilist);
+
+    Allocator get_allocator() const { return Allocator(alloc_); }
+    hasher hash_function() const { return hash_; }
+    key_equal key_eq() const { return equal_; }
+
+    iterator begin() { return iterator(head_.next()); }
+    iterator end() { return iterator(nullptr); }
+
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+    const_iterator cbegin() const { return const_iterator(head_.next()); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+
+    // keeps the buckets
+    void clear();
+
+    std::pair<iterator, bool> insert(const Value &value);
+    std::pair<iterator, bool> insert(Value &&value);
+    void insert(std::input_iterator auto first, std::input_iterator auto last);
+    void insert(std::initializer_list<Value> ilist);
+
+    // builds the element before it looks for its key
+    template <typename ...Args>
+    std::pair<iterator, bool> emplace(Args &&...args);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    size_type erase(const key_type &key);
+
+    iterator find(const key_type &key);
+    const_iterator find(const key_type &key) const;
+    bool contains(const key_type &key) const { return find(key) != end(); }
+    size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+    size_type bucket_count() const { return buckets_.size(); }
+    size_type bucket(const key_type &key) const { return index(hash_(key)); }
+
+    float load_factor() const;
+    float max_load_factor() const { return max_load_factor_; }
+    void max_load_factor(float load_factor);
+
+    // relinks the nodes into at least count buckets, more if the load
+    // factor requires, rounded up to a power of two
+    void rehash(size_type count);
+    void reserve(size_type count);
+
+    void swap(HashTable &other);
+
+protected:
+    std::size_t hash_key(const key_type &key) const { return hash_(key); }
+    size_type index(std::size_t hash) const;
+
+    static iterator node_iterator(Node *node) { return iterator(node); }
+
+    // the node with the key, nullptr if there is none
+    Node *find_node(const key_type &key, std::size_t hash) const;
+
+    // adds a bucket if one more element would exceed the load factor
+    void reserve_one();
+
+    // links a new node with a key that is not in the table yet, the table
+    // must have room for it
+    iterator link_node(Node *node);
+
+    template <typename ...Args>
+    Node *new_node(Args &&...args);
+    void delete_node(Node *node);
+
+private:
+    template <typename V>
+    std::pair<iterator, bool> insert_value(V &&value);
+
+    void relink(size_type count);
+    void steal(HashTable &other);
+    void copy_nodes(const HashTable &other);
+
+    NodeBase head_;
+    std::vector<NodeBase *, BucketAlloc> buckets_;
+    size_type size_ = 0;
+    int shift_ = 0;
+    float max_load_factor_ = 1.0f;
+
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] KeyEqual equal_;
+    [[no_unique_address]] NodeAlloc alloc_;
+};
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::HashTable(
+        size_type bucket_count,
+        const Hash &hash,
+        const KeyEqual &equal,
+        const Alloc &alloc)
+    : buckets_(BucketAlloc(alloc)), hash_(hash), equal_(equal), alloc_(alloc)
+{
+    if(bucket_count > 0) {
+        rehash(bucket_count);
+    }
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::HashTable(
+        std::input_iterator auto first,
+        std::input_iterator auto last,
+        size_type bucket_count,
+        const Hash &hash,
+        const KeyEqual &equal,
+        const Alloc &alloc)
+    : HashTable(bucket_count, hash, equal, alloc)
+{
+    insert(first, last);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::HashTable(
+        std::initializer_list<Value> ilist,
+        size_type bucket_count,
+        const Hash &hash,
+        const KeyEqual &equal,
+        const Alloc &alloc)
+    : HashTable(bucket_count, hash, equal, alloc)
+{
+    insert(ilist);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::HashTable(
+        const HashTable &other)
+    : HashTable(0, other.hash_, other.equal_,
+        Traits::select_on_container_copy_construction(
+            Alloc(other.alloc_)))
+{
+    max_load_factor_ = other.max_load_factor_;
+    copy_nodes(other);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::HashTable(HashTable &&other)
+    : buckets_(BucketAlloc(other.alloc_)), hash_(other.hash_),
+      equal_(other.equal_), alloc_(other.alloc_)
+{
+    steal(other);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc> &
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::operator = (
+        const HashTable &other)
+{
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    clear();
+
+    if(NodeTraits::propagate_on_container_copy_assignment::value) {
+        alloc_ = other.alloc_;
+    }
+
+    hash_ = other.hash_;
+    equal_ = other.equal_;
+    max_load_factor_ = other.max_load_factor_;
+    copy_nodes(other);
+    return *this;
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc> &
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::operator = (HashTable &&other) {
+    if(std::addressof(*this) == std::addressof(other)) {
+        return *this;
+    }
+
+    clear();
+    hash_ = other.hash_;
+    equal_ = other.equal_;
+    max_load_factor_ = other.max_load_factor_;
+
+    if(NodeTraits::propagate_on_container_move_assignment::value) {
+        alloc_ = other.alloc_;
+        steal(other);
+    } else if(alloc_ == other.alloc_) {
+        steal(other);
+    } else {
+        for(auto &value : other) {
+            insert(std::move(value));
+        }
+
+        other.clear();
+    }
+
+    return *this;
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc> &
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::operator = (
+        std::initializer_list<Value> ilist)
+{
+    clear();
+    insert(ilist);
+    return *this;
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::clear() {
+    for(NodeBase *node = head_.next(); node != nullptr;) {
+        auto *curr = static_cast<Node *>(node);
+        node = curr->next();
+        delete_node(curr);
+    }
+
+    head_.setNext(nullptr);
+    std::fill(buckets_.begin(), buckets_.end(), nullptr);
+    size_ = 0;
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+std::pair<typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator,
+          bool>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::insert(const Value &value) {
+    return insert_value(value);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+std::pair<typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator,
+          bool>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::insert(Value &&value) {
+    return insert_value(std::move(value));
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::insert(
+        std::input_iterator auto first,
+        std::input_iterator auto last)
+{
+    if constexpr(std::forward_iterator<decltype(first)>) {
+        reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+    }
+
+    for(; first != last; ++first) {
+        emplace(*first);
+    }
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::insert(
+        std::initializer_list<Value> ilist)
+{
+    insert(ilist.begin(), ilist.end());
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename ...Args>
+std::pair<typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator,
+          bool>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::emplace(Args &&...args) {
+    Node *node = new_node(std::forward<Args>(args)...);
+
+    try {
+        const key_type &key = KeyOf{}(node->value());
+        node->hash_ = hash_(key);
+
+        if(Node *found = find_node(key, node->hash_)) {
+            delete_node(node);
+            return {iterator(found), false};
+        }
+
+        reserve_one();
+    } catch(...) {
+        delete_node(node);
+        throw;
+    }
+
+    return {link_node(node), true};
+}
+
+//the first node of a bucket follows the node the bucket points to, when it
+//goes, the bucket of the next node may have to point elsewhere
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::erase(const_iterator pos) {
+    auto *node = static_cast<Node *>(pos.node());
+    size_type bucket = index(node->hash_);
+
+    NodeBase *prev = buckets_[bucket];
+    while(prev->next() != node) {
+        prev = prev->next();
+    }
+
+    auto *next = static_cast<Node *>(node->next());
+    size_type next_bucket = next != nullptr ? index(next->hash_) : bucket;
+
+    if(prev == buckets_[bucket]) {
+        if(next == nullptr || next_bucket != bucket) {
+            if(next != nullptr) {
+                buckets_[next_bucket] = prev;
+            }
+
+            buckets_[bucket] = nullptr;
+        }
+    } else if(next_bucket != bucket) {
+        buckets_[next_bucket] = prev;
+    }
+
+    prev->setNext(next);
+    delete_node(node);
+    --size_;
+    return iterator(next);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::erase(
+        const_iterator first,
+        const_iterator last)
+{
+    while(first != last) {
+        first = erase(first);
+    }
+
+    return iterator(last.node_);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::size_type
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::erase(const key_type &key) {
+    const_iterator it = find(key);
+
+    if(it == end()) {
+        return 0;
+    }
+
+    erase(it);
+    return 1;
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::find(const key_type &key) {
+    if(size_ == 0) {
+        return end();
+    }
+
+    return iterator(find_node(key, hash_(key)));
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::const_iterator
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::find(
+        const key_type &key) const
+{
+    if(size_ == 0) {
+        return end();
+    }
+
+    return const_iterator(find_node(key, hash_(key)));
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+float HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::load_factor() const {
+    if(buckets_.empty()) {
+        return 0.0f;
+    }
+
+    return static_cast<float>(size_) / static_cast<float>(buckets_.size());
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::max_load_factor(
+        float load_factor)
+{
+    max_load_factor_ = load_factor;
+    rehash(0);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::rehash(size_type count) {
+    auto needed = static_cast<size_type>(
+            std::ceil(static_cast<float>(size_) / max_load_factor_));
+    count = std::max(count, needed);
+
+    if(count == 0) {
+        return;
+    }
+
+    count = std::bit_ceil(std::max(count, min_bucket_count));
+
+    if(count != buckets_.size()) {
+        relink(count);
+    }
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::reserve(size_type count) {
+    auto needed = static_cast<size_type>(
+            std::ceil(static_cast<float>(count) / max_load_factor_));
+
+    if(needed > buckets_.size()) {
+        rehash(needed);
+    }
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::swap(HashTable &other) {
+    std::swap(*this, other);
+}
+
+//the multiplication spreads the low bits of hashes like the ones of
+//std::hash<int> over the top bits, which pick the bucket
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::size_type
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::index(std::size_t hash) const {
+    return static_cast<size_type>(
+            (static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15) >> shift_);
+}
+
+//the nodes of the bucket end where a node of another bucket starts
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::Node *
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::find_node(
+        const key_type &key,
+        std::size_t hash) const
+{
+    if(buckets_.empty()) {
+        return nullptr;
+    }
+
+    size_type bucket = index(hash);
+    NodeBase *prev = buckets_[bucket];
+
+    if(prev == nullptr) {
+        return nullptr;
+    }
+
+    for(auto *node = static_cast<Node *>(prev->next()); node != nullptr;
+            node = static_cast<Node *>(node->next()))
+    {
+        if(node->hash_ == hash && equal_(key, KeyOf{}(node->value()))) {
+            return node;
+        }
+
+        if(node->hash_ != hash && index(node->hash_) != bucket) {
+            return nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::reserve_one() {
+    if(static_cast<float>(size_ + 1) >
+            static_cast<float>(buckets_.size()) * max_load_factor_) {
+        rehash(std::max(buckets_.size() * 2, min_bucket_count));
+    }
+}
+
+//an empty bucket starts at the front of the list, the bucket of the node
+//that was first now starts after the new node
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::link_node(Node *node) {
+    size_type bucket = index(node->hash_);
+
+    if(buckets_[bucket] != nullptr) {
+        node->setNext(buckets_[bucket]->next());
+        buckets_[bucket]->setNext(node);
+    } else {
+        auto *first = static_cast<Node *>(head_.next());
+        node->setNext(first);
+        head_.setNext(node);
+
+        if(first != nullptr) {
+            buckets_[index(first->hash_)] = node;
+        }
+
+        buckets_[bucket] = &head_;
+    }
+
+    ++size_;
+    return iterator(node);
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename ...Args>
+typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::Node *
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::new_node(Args &&...args) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+
+    try {
+        NodeTraits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch(...) {
+        NodeTraits::deallocate(alloc_, node, 1);
+        throw;
+    }
+
+    return node;
+}
+
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::delete_node(Node *node) {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+}
+
+//looks the key up before it builds a node
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+template <typename V>
+std::pair<typename HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::iterator,
+          bool>
+HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::insert_value(V &&value) {
+    const key_type &key = KeyOf{}(value);
+    std::size_t hash = hash_(key);
+
+    if(Node *found = find_node(key, hash)) {
+        return {iterator(found), false};
+    }
+
+    reserve_one();
+    Node *node = new_node(std::forward<V>(value));
+    node->hash_ = hash;
+    return {link_node(node), true};
+}
+
+//walks the list once and moves every node to the front of its new bucket,
+//a new bucket starts at the front of the list
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::relink(size_type count) {
+    std::vector<NodeBase *, BucketAlloc> buckets(count, nullptr,
+            buckets_.get_allocator());
+
+    shift_ = 64 - std::countr_zero(count);
+
+    auto *node = static_cast<Node *>(head_.next());
+    head_.setNext(nullptr);
+    size_type first_bucket = 0;
+
+    while(node != nullptr) {
+        auto *next = static_cast<Node *>(node->next());
+        size_type bucket = index(node->hash_);
+
+        if(buckets[bucket] == nullptr) {
+            node->setNext(head_.next());
+            head_.setNext(node);
+
+            if(node->next() != nullptr) {
+                buckets[first_bucket] = node;
+            }
+
+            buckets[bucket] = &head_;
+            first_bucket = bucket;
+        } else {
+            node->setNext(buckets[bucket]->next());
+            buckets[bucket]->setNext(node);
+        }
+
+        node = next;
+    }
+
+    buckets_.swap(buckets);
+}
+
+//the bucket of the first node points to the head of the other table
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::steal(HashTable &other) {
+    head_.setNext(other.head_.next());
+    buckets_.swap(other.buckets_);
+    size_ = other.size_;
+    shift_ = other.shift_;
+    max_load_factor_ = other.max_load_factor_;
+
+    if(auto *first = static_cast<Node *>(head_.next())) {
+        buckets_[index(first->hash_)] = &head_;
+    }
+
+    other.head_.setNext(nullptr);
+    other.buckets_.clear();
+    other.size_ = 0;
+}
+
+//the hashes of the other table are reused
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+void HashTable<Value, KeyOf, Hash, KeyEqual, Alloc>::copy_nodes(
+        const HashTable &other)
+{
+    reserve(other.size_);
+
+    for(auto *node = static_cast<Node *>(other.head_.next()); node != nullptr;
+            node = static_cast<Node *>(node->next()))
+    {
+        Node *copy = new_node(node->value());
+        copy->hash_ = node->hash_;
+        link_node(copy);
+    }
+}
+
+// tables are equal if they hold equal elements, in any order
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual,
+         typename Alloc>
+bool operator == (
+        const HashTable<Value, KeyOf, Hash, KeyEqual, Alloc> &lhs,
+        const HashTable<Value, KeyOf, Hash, KeyEqual, Alloc> &rhs)
+{
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    for(const Value &value : lhs) {
+        auto it = rhs.find(KeyOf{}(value));
+
+        if(it == rhs.end() || !(*it == value)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace mystd {
+
+// Link embedded into the elements of an IntrusiveForwardList:
+//
+// struct Task {
+//     int id;
+//     mystd::IntrusiveForwardListHook hook;
+// };
+//
+// mystd::IntrusiveForwardList<Task, &Task::hook> tasks;
+//
+// Copying an element does not copy its link, so the copy is not linked.
+class IntrusiveForwardListHook {
+public:
+    IntrusiveForwardListHook(IntrusiveForwardListHook *next = nullptr)
+        : next_(next) {}
+
+    IntrusiveForwardListHook(const IntrusiveForwardListHook &)
+        : next_(nullptr) {}
+
+    IntrusiveForwardListHook &operator = (const IntrusiveForwardListHook &) {
+        return *this;
+    }
+
+    void setNext(IntrusiveForwardListHook *next) { next_ = next; }
+    IntrusiveForwardListHook *next() const { return next_; }
+
+private:
+    IntrusiveForwardListHook *next_;
+};
+
+namespace detail {
+
+// Distance from the start of T to its Hook member. The Itanium and the
+// Microsoft C++ ABIs both store a pointer to a data member of a class
+// without virtual bases as that offset, so it is read from Hook itself and
+// no T is ever made. Hook is a constant, the read folds to a number.
+template <typename T, IntrusiveForwardListHook T::*Hook>
+std::ptrdiff_t hook_offset() {
+    using Representation = std::conditional_t<
+        sizeof(Hook) == sizeof(std::int32_t), std::int32_t, std::ptrdiff_t>;
+
+    static_assert(sizeof(Representation) == sizeof(Hook),
+            "IntrusiveForwardList: unknown layout of pointers to members");
+
+    return static_cast<std::ptrdiff_t>(std::bit_cast<Representation>(Hook));
+}
+
+// Returns the element that embeds hook as its Hook member.
+template <typename T, IntrusiveForwardListHook T::*Hook>
+T *hook_owner(IntrusiveForwardListHook *hook) {
+    return reinterpret_cast<T *>(
+            reinterpret_cast<unsigned char *>(hook) - hook_offset<T, Hook>());
+}
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "intrusive_forward_list_hook.hpp"
+
+namespace mystd {
+
+template <typename T, IntrusiveForwardListHook T::*Hook>
+class IntrusiveForwardList;
+
+namespace detail {
+
+template <bool IsConst, typename T, IntrusiveForwardListHook T::*Hook>
+class IntrusiveFwdListIterator {
+    template<typename U, IntrusiveForwardListHook U::*>
+    friend class mystd::IntrusiveForwardList;
+
+    friend class IntrusiveFwdListIterator<true, T, Hook>;
+
+    using conditional = std::conditional_t<IsConst, const T, T>;
+    using NodeBase = IntrusiveForwardListHook;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = conditional *;
+    using reference = conditional &;
+    using iterator_category = typename std::forward_iterator_tag;
+
+    IntrusiveFwdListIterator() : node_(nullptr) {}
+
+    IntrusiveFwdListIterator(
+            const IntrusiveFwdListIterator<false, T, Hook> &iterator)
+        : node_(iterator.node_) {}
+
+    IntrusiveFwdListIterator &operator = (
+            const IntrusiveFwdListIterator &iterator) = default;
+
+    IntrusiveFwdListIterator &operator ++ () {
+        node_ = node_->next();
+        return *this;
+    }
+
+    IntrusiveFwdListIterator operator ++ (int) {
+        auto copy = *this;
+        node_ = node_->next();
+        return copy;
+    }
+
+    reference operator * () const { return *hook_owner<T, Hook>(node_); }
+    pointer operator -> () const { return hook_owner<T, Hook>(node_); }
+
+    bool operator == (const IntrusiveFwdListIterator &rhs) const = default;
+
+private:
+    explicit IntrusiveFwdListIterator(NodeBase *node) : node_(node) {}
+
+    void setNext(NodeBase *next) { node_->setNext(next); }
+    NodeBase *next() const { return node_->next(); }
+
+    NodeBase *node_;
+};
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,48 @@
+#pragma once
+
+namespace mystd {
+
+// Optional bookkeeping of ForwardList, combined with operator |:
+//
+// mystd::ForwardList<int, std::allocator<int>,
+//         mystd::track_size | mystd::track_tail> list;
+//
+// Every flag adds one member to the list, the nodes are never affected.
+enum class list_policy : unsigned {
+    none = 0,
+    // keeps the number of elements, enables size()
+    track_size = 1 << 0,
+    // keeps a pointer to the last node, enables back() and push_back()
+    track_tail = 1 << 1,
+    // keeps erased nodes for the next insertions instead of deallocating
+    // them, enables reserve() and shrink_to_fit()
+    recycle_nodes = 1 << 2
+};
+
+constexpr list_policy operator | (list_policy lhs, list_policy rhs) {
+    return static_cast<list_policy>(
+            static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+
+constexpr bool has_policy(list_policy policy, list_policy flag) {
+    return (static_cast<unsigned>(policy) & static_cast<unsigned>(flag)) != 0;
+}
+
+inline constexpr list_policy track_size = list_policy::track_size;
+inline constexpr list_policy track_tail = list_policy::track_tail;
+inline constexpr list_policy recycle_nodes = list_policy::recycle_nodes;
+
+namespace detail {
+
+// Stand-ins for the members of a disabled policy, they take no space
+// with [[no_unique_address]]
+struct NoSizeCounter {};
+
+struct NoTailPointer {
+    constexpr NoTailPointer(const void *) {}
+};
+
+struct NoSpareNodes {};
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mystd {
+namespace detail {
+
+// A file mapped into memory for reading and writing, POSIX only. The
+// mapping is shared, so the changes reach the file. Resizing maps the file
+// anew and may move it, so the file is addressed by offsets from data().
+class MappedFile {
+public:
+    // opens the file or creates an empty one
+    explicit MappedFile(const std::filesystem::path &path);
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator = (MappedFile &&other) noexcept;
+
+    ~MappedFile();
+
+    std::byte *data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+    void resize(std::size_t size);
+
+    // writes the changed pages back to the file and waits for it
+    void flush();
+
+private:
+    void map();
+    void unmap();
+    void close();
+
+    [[noreturn]] static void fail(const char *what);
+
+    int fd_ = -1;
+    std::byte *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+inline MappedFile::MappedFile(const std::filesystem::path &path) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+    if(fd_ == -1) {
+        fail("MappedFile: open");
+    }
+
+    struct stat status;
+
+    if(::fstat(fd_, &status) == -1) {
+        int error = errno;
+        close();
+        errno = error;
+        fail("MappedFile: fstat");
+    }
+
+    size_ = static_cast<std::size_t>(status.st_size);
+
+    try {
+        map();
+    } catch(...) {
+        close();
+        throw;
+    }
+}
+
+inline MappedFile::MappedFile(MappedFile &&other) noexcept
+    : fd_(std::exchange(other.fd_, -1)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0))
+{}
+
+inline MappedFile &MappedFile::operator = (MappedFile &&other) noexcept {
+    if(this != &other) {
+        unmap();
+        close();
+        fd_ = std::exchange(other.fd_, -1);
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    return *this;
+}
+
+inline MappedFile::~MappedFile() {
+    unmap();
+    close();
+}
+
+//the file keeps its old size and mapping if it can't be resized
+inline void MappedFile::resize(std::size_t size) {
+    if(::ftruncate(fd_, static_cast<off_t>(size)) == -1) {
+        fail("MappedFile: ftruncate");
+    }
+
+    std::size_t old_size = std::exchange(size_, size);
+    std::byte *old_data = std::exchange(data_, nullptr);
+
+    try {
+        map();
+    } catch(...) {
+        //best effort, the old mapping stays valid either way
+        [[maybe_unused]] int result =
+            ::ftruncate(fd_, static_cast<off_t>(old_size));
+        size_ = old_size;
+        data_ = old_data;
+        throw;
+    }
+
+    if(old_data != nullptr) {
+        ::munmap(old_data, old_size);
+    }
+}
+
+inline void MappedFile::flush() {
+    if(data_ != nullptr && ::msync(data_, size_, MS_SYNC) == -1) {
+        fail("MappedFile: msync");
+    }
+}
+
+//an empty file is not mapped
+inline void MappedFile::map() {
+    if(size_ == 0) {
+        return;
+    }
+
+    void *data = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd_, 0);
+
+    if(data == MAP_FAILED) {
+        fail("MappedFile: mmap");
+    }
+
+    data_ = static_cast<std::byte *>(data);
+}
+
+inline void MappedFile::unmap() {
+    if(data_ != nullptr) {
+        ::munmap(data_, size_);
+        data_ = nullptr;
+    }
+}
+
+inline void MappedFile::close() {
+    if(fd_ != -1) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+inline void MappedFile::fail(const char *what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+} //end namespace detail
+} //end namespace mystd
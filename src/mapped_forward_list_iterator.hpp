@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "mapped_forward_list_node.hpp"
+
+namespace mystd {
+
+template <typename T>
+class MappedForwardList;
+
+namespace detail {
+
+// Points to the offset of a node in the file of a list. The before-begin
+// iterator has the offset before_first_offset, the end iterator null_offset.
+template <bool IsConst, typename T>
+class MappedFwdListIterator {
+    template<typename>
+    friend class mystd::MappedForwardList;
+
+    friend class MappedFwdListIterator<true, T>;
+
+    using conditional = std::conditional_t<IsConst, const T, T>;
+    using Arena = MappedFwdListArena<T>;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = conditional *;
+    using reference = conditional &;
+    using iterator_category = typename std::forward_iterator_tag;
+
+    MappedFwdListIterator() : arena_(nullptr), offset_(null_offset) {}
+
+    MappedFwdListIterator(const MappedFwdListIterator<false, T> &iterator)
+        : arena_(iterator.arena_), offset_(iterator.offset_) {}
+
+    MappedFwdListIterator &operator = (
+            const MappedFwdListIterator &iterator) = default;
+
+    MappedFwdListIterator &operator ++ ();
+    MappedFwdListIterator operator ++ (int);
+    reference operator * () const;
+    pointer operator -> () const;
+
+    bool operator == (const MappedFwdListIterator &rhs) const = default;
+
+private:
+    MappedFwdListIterator(Arena *arena, mapped_offset offset)
+        : arena_(arena), offset_(offset) {}
+
+    mapped_offset next() const { return arena_->next(offset_); }
+
+    Arena *arena_;
+    mapped_offset offset_;
+};
+
+template <bool IsConst, typename T>
+MappedFwdListIterator<IsConst, T> &
+MappedFwdListIterator<IsConst, T>::operator ++ () {
+    offset_ = next();
+    return *this;
+}
+
+template <bool IsConst, typename T>
+MappedFwdListIterator<IsConst, T>
+MappedFwdListIterator<IsConst, T>::operator ++ (int) {
+    auto copy = *this;
+    offset_ = next();
+    return copy;
+}
+
+template <bool IsConst, typename T>
+typename MappedFwdListIterator<IsConst, T>::reference
+    MappedFwdListIterator<IsConst, T>::operator * () const
+{
+    return arena_->node(offset_).value;
+}
+
+template <bool IsConst, typename T>
+typename MappedFwdListIterator<IsConst, T>::pointer
+    MappedFwdListIterator<IsConst, T>::operator -> () const
+{
+    return std::addressof(arena_->node(offset_).value);
+}
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "mapped_file.hpp"
+
+namespace mystd {
+namespace detail {
+
+// position in the file of a list, the header lies at 0,
+// so no node has the offset 0
+using mapped_offset = std::uint64_t;
+
+inline constexpr mapped_offset null_offset = 0;
+
+// Start of the file of a MappedForwardList. The file is only readable by
+// builds with the same node layout and byte order. The size and alignment
+// of the element are kept apart from the ones of the node, since elements
+// of different types often make nodes of the same size.
+struct MappedFwdListHeader {
+    // "MYSTDFL1" read as a little endian number
+    static constexpr std::uint64_t file_magic = 0x314c46445453594dULL;
+    static constexpr std::uint32_t file_version = 2;
+
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t node_size;
+    std::uint64_t node_align;
+    std::uint64_t element_size;
+    std::uint64_t element_align;
+    // number of elements
+    std::uint64_t size;
+    // first node of the free list
+    mapped_offset free;
+    // end of the nodes that were ever handed out
+    mapped_offset used;
+    // first node of the list
+    mapped_offset head;
+};
+
+// offset of the position before the first node, it is no node offset
+inline constexpr mapped_offset before_first_offset =
+    offsetof(MappedFwdListHeader, head);
+
+template <typename T>
+struct MappedFwdListNode {
+    template <typename ...Args>
+    explicit MappedFwdListNode(mapped_offset next_, Args &&...args)
+        : next(next_), value(std::forward<Args>(args)...) {}
+
+    mapped_offset next;
+    T value;
+};
+
+// Hands out the nodes of a list from a mapped file. Freed nodes are kept
+// on a free list in the file, the file grows when both are used up. The
+// mapping may move while it grows, so the nodes are addressed by offset.
+template <typename T>
+class MappedFwdListArena {
+public:
+    using Node = MappedFwdListNode<T>;
+
+    // opens the file and checks its header, an empty file gets one
+    explicit MappedFwdListArena(const std::filesystem::path &path);
+
+    MappedFwdListHeader &header() const {
+        return *reinterpret_cast<MappedFwdListHeader *>(file_.data());
+    }
+
+    Node &node(mapped_offset offset) const {
+        return *reinterpret_cast<Node *>(file_.data() + offset);
+    }
+
+    mapped_offset next(mapped_offset pos) const {
+        return pos == before_first_offset ? header().head : node(pos).next;
+    }
+
+    void setNext(mapped_offset pos, mapped_offset next) {
+        if(pos == before_first_offset) {
+            header().head = next;
+        } else {
+            node(pos).next = next;
+        }
+    }
+
+    // storage for a node, invalidates the references into the file
+    // if the file grows
+    mapped_offset allocate();
+    void deallocate(mapped_offset offset);
+
+    // makes every node unused
+    void reset();
+
+    std::size_t capacity() const {
+        return (file_.size() - nodes_begin) / sizeof(Node);
+    }
+
+    void reserve(std::size_t count);
+
+    void flush() { file_.flush(); }
+
+private:
+    static constexpr std::size_t nodes_begin =
+        (sizeof(MappedFwdListHeader) + alignof(Node) - 1)
+        / alignof(Node) * alignof(Node);
+
+    // the file grows at least by the factor and in whole granules
+    static constexpr std::size_t growth_factor = 2;
+    static constexpr std::size_t growth_granule = 1 << 16;
+
+    void grow(std::size_t size);
+
+    MappedFile file_;
+};
+
+template <typename T>
+MappedFwdListArena<T>::MappedFwdListArena(const std::filesystem::path &path)
+    : file_(path)
+{
+    if(file_.size() == 0) {
+        grow(nodes_begin);
+        std::construct_at(&header(), MappedFwdListHeader{
+                MappedFwdListHeader::file_magic,
+                MappedFwdListHeader::file_version,
+                sizeof(Node), alignof(Node), sizeof(T), alignof(T), 0,
+                null_offset, nodes_begin, null_offset});
+        return;
+    }
+
+    MappedFwdListHeader *header = file_.size() >= nodes_begin
+        ? &this->header() : nullptr;
+
+    if(header == nullptr
+            || header->magic != MappedFwdListHeader::file_magic
+            || header->version != MappedFwdListHeader::file_version
+            || header->node_size != sizeof(Node)
+            || header->node_align != alignof(Node)
+            || header->element_size != sizeof(T)
+            || header->element_align != alignof(T)
+            || header->used < nodes_begin 
+            || header->used > file_.size())
+    {
+        throw std::runtime_error(
+                "MappedForwardList: the file holds no list of this type");
+    }
+}
+
+template <typename T>
+mapped_offset MappedFwdListArena<T>::allocate() {
+    if(header().free != null_offset) {
+        mapped_offset offset = header().free;
+        header().free = node(offset).next;
+        return offset;
+    }
+
+    if(header().used + sizeof(Node) > file_.size()) {
+        grow(header().used + sizeof(Node));
+    }
+
+    mapped_offset offset = header().used;
+    header().used += sizeof(Node);
+    return offset;
+}
+
+template <typename T>
+void MappedFwdListArena<T>::deallocate(mapped_offset offset) {
+    node(offset).next = header().free;
+    header().free = offset;
+}
+
+template <typename T>
+void MappedFwdListArena<T>::reset() {
+    header().size = 0;
+    header().free = null_offset;
+    header().used = nodes_begin;
+    header().head = null_offset;
+}
+
+template <typename T>
+void MappedFwdListArena<T>::reserve(std::size_t count) {
+    if(count > capacity()) {
+        grow(nodes_begin + count * sizeof(Node));
+    }
+}
+
+template <typename T>
+void MappedFwdListArena<T>::grow(std::size_t size) {
+    size = std::max(size, growth_factor * file_.size());
+    size = (size + growth_granule - 1) / growth_granule * growth_granule;
+    file_.resize(size);
+}
+
+} //end namespace detail
+} //end namespace mystd
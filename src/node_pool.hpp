@@ -0,0 +1,285 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace mystd {
+namespace detail {
+
+// Process-wide pool of fixed-size blocks. Memory is taken from the system in
+// large slabs that are carved into blocks and threaded into an intrusive free
+// list, so a freed block is handed out again without touching malloc. Slabs
+// are never returned to the system.
+template <std::size_t BlockSize, std::size_t BlockAlign>
+class NodePool {
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+public:
+    static constexpr std::size_t block_align =
+        BlockAlign > alignof(FreeBlock) ? BlockAlign : alignof(FreeBlock);
+
+    static constexpr std::size_t block_size =
+        ((BlockSize > sizeof(FreeBlock) ? BlockSize : sizeof(FreeBlock))
+            + block_align - 1) & ~(block_align - 1);
+
+    static constexpr std::size_t slab_size =
+        block_size * 64 > 64 * 1024 ? block_size * 64 : 64 * 1024;
+
+    static constexpr std::size_t blocks_per_slab = slab_size / block_size;
+
+    // number of blocks moved between the pool and a thread cache at once
+    static constexpr std::size_t cache_batch = 64;
+
+    NodePool(const NodePool &) = delete;
+    NodePool &operator = (const NodePool &) = delete;
+
+    // the pool outlives every static and thread_local object that may still
+    // hold its blocks, so it is intentionally never destroyed
+    static NodePool &instance() {
+        static NodePool *pool = new NodePool();
+        return *pool;
+    }
+
+    void *allocate();
+    void deallocate(void *block);
+
+    // count blocks that are adjacent in memory, each block is deallocated
+    // on its own. They are taken from the head of the free list, after the
+    // thread cache, if it holds such a run, else from a new slab whose other
+    // blocks join the free list
+    void *allocate_run(std::size_t count);
+
+    void *cached_allocate();
+    void cached_deallocate(void *block);
+
+private:
+    struct ThreadCache {
+        ~ThreadCache();
+
+        FreeBlock *head = nullptr;
+        std::size_t count = 0;
+    };
+
+    NodePool() = default;
+
+    static ThreadCache &thread_cache() {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+
+    static FreeBlock *last_block(FreeBlock *block) {
+        while(block->next != nullptr) {
+            block = block->next;
+        }
+        return block;
+    }
+
+    // pops up to count blocks, returns the number of blocks actually taken
+    std::size_t acquire(FreeBlock *&first, std::size_t count);
+    // pops the first count free blocks if they are adjacent in memory
+    void *take_run(std::size_t count);
+    void release(FreeBlock *first, FreeBlock *last);
+    void grow();
+    void thread_blocks(std::byte *slab, std::size_t first, std::size_t last);
+
+    std::mutex mutex_;
+    FreeBlock *free_ = nullptr;
+};
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void *NodePool<BlockSize, BlockAlign>::allocate() {
+    std::lock_guard lock(mutex_);
+
+    if(free_ == nullptr) {
+        grow();
+    }
+
+    FreeBlock *block = free_;
+    free_ = block->next;
+    return block;
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void *NodePool<BlockSize, BlockAlign>::allocate_run(std::size_t count) {
+    //the blocks of a list that was just destroyed are in the thread cache
+    ThreadCache &cache = thread_cache();
+
+    if(cache.head != nullptr) {
+        release(cache.head, last_block(cache.head));
+        cache.head = nullptr;
+        cache.count = 0;
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+
+        if(void *run = take_run(count)) {
+            return run;
+        }
+    }
+
+    std::size_t blocks = count > blocks_per_slab ? count : blocks_per_slab;
+    auto *slab = static_cast<std::byte *>(::operator new(
+                blocks * block_size, std::align_val_t{block_align}));
+
+    std::lock_guard lock(mutex_);
+    thread_blocks(slab, count, blocks);
+    return slab;
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void NodePool<BlockSize, BlockAlign>::deallocate(void *block) {
+    auto *free_block = static_cast<FreeBlock *>(block);
+    release(free_block, free_block);
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void *NodePool<BlockSize, BlockAlign>::cached_allocate() {
+    ThreadCache &cache = thread_cache();
+
+    if(cache.head == nullptr) {
+        cache.count = acquire(cache.head, cache_batch);
+    }
+
+    FreeBlock *block = cache.head;
+    cache.head = block->next;
+    --cache.count;
+    return block;
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void NodePool<BlockSize, BlockAlign>::cached_deallocate(void *block) {
+    ThreadCache &cache = thread_cache();
+    auto *free_block = static_cast<FreeBlock *>(block);
+
+    free_block->next = cache.head;
+    cache.head = free_block;
+
+    if(++cache.count < 2 * cache_batch) {
+        return;
+    }
+
+    // keep the most recently freed blocks hot in the cache,
+    // hand the older half back to the pool
+    FreeBlock *last = cache.head;
+    for(std::size_t i = 1; i < cache_batch; ++i) {
+        last = last->next;
+    }
+
+    release(last->next, last_block(last->next));
+    last->next = nullptr;
+    cache.count = cache_batch;
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+NodePool<BlockSize, BlockAlign>::ThreadCache::~ThreadCache() {
+    if(head == nullptr) {
+        return;
+    }
+
+    NodePool::instance().release(head, last_block(head));
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+std::size_t NodePool<BlockSize, BlockAlign>::acquire(
+        FreeBlock *&first,
+        std::size_t count)
+{
+    std::lock_guard lock(mutex_);
+
+    if(free_ == nullptr) {
+        grow();
+    }
+
+    first = free_;
+    FreeBlock *last = free_;
+    std::size_t taken = 1;
+
+    for(; taken < count && last->next != nullptr; ++taken) {
+        last = last->next;
+    }
+
+    free_ = last->next;
+    last->next = nullptr;
+    return taken;
+}
+
+// the blocks of a list freed in list order come back to the free list in
+// descending order, the rest of a slab in ascending order, both are runs
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void *NodePool<BlockSize, BlockAlign>::take_run(std::size_t count) {
+    if(free_ == nullptr || count == 0) {
+        return nullptr;
+    }
+
+    auto *first = reinterpret_cast<std::byte *>(free_);
+    auto *lowest = first;
+    FreeBlock *block = free_;
+    std::ptrdiff_t step = 0;
+
+    for(std::size_t i = 1; i < count; ++i) {
+        auto *next = reinterpret_cast<std::byte *>(block->next);
+
+        if(next == nullptr) {
+            return nullptr;
+        }
+
+        if(step == 0) {
+            step = next - first;
+
+            if(step != static_cast<std::ptrdiff_t>(block_size) &&
+                    step != -static_cast<std::ptrdiff_t>(block_size)) {
+                return nullptr;
+            }
+        } else if(next - reinterpret_cast<std::byte *>(block) != step) {
+            return nullptr;
+        }
+
+        block = block->next;
+        lowest = step < 0 ? next : lowest;
+    }
+
+    free_ = block->next;
+    return lowest;
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void NodePool<BlockSize, BlockAlign>::release(
+        FreeBlock *first,
+        FreeBlock *last)
+{
+    std::lock_guard lock(mutex_);
+    last->next = free_;
+    free_ = first;
+}
+
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void NodePool<BlockSize, BlockAlign>::grow() {
+    auto *slab = static_cast<std::byte *>(
+            ::operator new(slab_size, std::align_val_t{block_align}));
+
+    thread_blocks(slab, 0, blocks_per_slab);
+}
+
+// pushes the blocks [first, last) of the slab on the free list
+template <std::size_t BlockSize, std::size_t BlockAlign>
+void NodePool<BlockSize, BlockAlign>::thread_blocks(
+        std::byte *slab,
+        std::size_t first,
+        std::size_t last)
+{
+    // thread the slab back to front, so blocks are handed out
+    // in address order and consecutive allocations stay adjacent
+    for(std::size_t i = last; i > first; --i) {
+        auto *block = reinterpret_cast<FreeBlock *>(
+                slab + (i - 1) * block_size);
+        block->next = free_;
+        free_ = block;
+    }
+}
+
+} //end namespace detail
+} //end namespace mystd
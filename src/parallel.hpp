@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace mystd {
+
+// Execution policy of the parallel container algorithms.
+// threads == 0 stands for std::thread::hardware_concurrency().
+struct parallel_policy {
+    unsigned threads = 0;
+
+    unsigned thread_count() const {
+        if(threads != 0) {
+            return threads;
+        }
+
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware != 0 ? hardware : 1;
+    }
+};
+
+inline constexpr parallel_policy par{};
+
+namespace detail {
+
+// Runs task(i) for every i in [0, count), each on its own thread. The calling
+// thread runs task(0) and joins the rest. If a thread cannot be started its
+// task runs on the calling thread. Returns the first exception thrown by a
+// task, the other tasks still run to completion.
+template <typename Task>
+std::exception_ptr parallel_invoke(std::size_t count, Task &task) {
+    std::vector<std::exception_ptr> errors(count);
+
+    auto run = [&task, &errors](std::size_t i) {
+        try {
+            task(i);
+        } catch(...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(count);
+
+        for(std::size_t i = 1; i < count; ++i) {
+            try {
+                workers.emplace_back(run, i);
+            } catch(const std::system_error &) {
+                run(i);
+            }
+        }
+
+        run(0);
+    }
+
+    for(auto &error : errors) {
+        if(error) {
+            return error;
+        }
+    }
+
+    return nullptr;
+}
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#include "forward_list_iterator.hpp"
+
+namespace mystd {
+
+template <typename T, typename Allocator>
+class RcuForwardList;
+
+namespace detail {
+
+// Read-only iterator that follows the links with acquire loads, so it sees
+// every node the writer has published completely. Only valid inside the
+// read section it was obtained in, or in the writer thread.
+template <typename T>
+class RcuFwdListIterator {
+    template<typename, typename Allocator>
+    friend class mystd::RcuForwardList;
+
+    using NodeBase = FwdListNodeBase<T>;
+    using Node = FwdListNode<T>;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T *;
+    using reference = const T &;
+    using iterator_category = typename std::forward_iterator_tag;
+
+    RcuFwdListIterator() : node_(nullptr) {}
+
+    RcuFwdListIterator &operator ++ ();
+    RcuFwdListIterator operator ++ (int);
+    reference operator * () const;
+    pointer operator -> () const;
+
+    bool operator == (const RcuFwdListIterator &rhs) const = default;
+
+private:
+    explicit RcuFwdListIterator(const NodeBase *node)
+        : node_(const_cast<NodeBase *>(node)) {}
+
+    Node *node() const { return static_cast<Node *>(node_); }
+    Node *next() const { return node_->loadNext(std::memory_order_acquire); }
+
+    NodeBase *node_;
+};
+
+template <typename T>
+RcuFwdListIterator<T> &RcuFwdListIterator<T>::operator ++ () {
+    node_ = next();
+    return *this;
+}
+
+template <typename T>
+RcuFwdListIterator<T> RcuFwdListIterator<T>::operator ++ (int) {
+    auto copy = *this;
+    node_ = next();
+    return copy;
+}
+
+template <typename T>
+typename RcuFwdListIterator<T>::reference
+    RcuFwdListIterator<T>::operator * () const
+{
+    return node()->value();
+}
+
+template <typename T>
+typename RcuFwdListIterator<T>::pointer
+    RcuFwdListIterator<T>::operator -> () const
+{
+    return std::addressof(node()->value());
+}
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "forward_list_iterator.hpp"
+
+namespace mystd {
+namespace detail {
+
+// Node of a SkipList. The level 0 link and the key are those of a
+// FwdListNode, so the level 0 chain is walked by ForwardList iterators. The
+// links of the upper levels follow the node in the same allocation, which
+// takes units(height) objects of the node type.
+template <typename K>
+struct SkipListNode : public FwdListNode<K> {
+    using Base = FwdListNodeBase<K>;
+
+    template <typename ...Args>
+    explicit SkipListNode(std::size_t height, Args &&...args)
+        : FwdListNode<K>(nullptr, std::forward<Args>(args)...),
+          height_(static_cast<std::uint8_t>(height))
+    {
+        for(std::size_t level = 1; level < height; ++level) {
+            upper(level) = nullptr;
+        }
+    }
+
+    std::size_t height() const { return height_; }
+
+    // link of the level, 0 < level < height()
+    Base *&upper(std::size_t level) {
+        auto *links = reinterpret_cast<Base **>(
+                reinterpret_cast<std::byte *>(this) + sizeof(SkipListNode));
+        return links[level - 1];
+    }
+
+    // number of node sized objects a node of the height takes
+    static constexpr std::size_t units(std::size_t height) {
+        return 1 + ((height - 1) * sizeof(Base *) + sizeof(SkipListNode) - 1)
+            / sizeof(SkipListNode);
+    }
+
+private:
+    std::uint8_t height_;
+};
+
+} //end namespace detail
+} //end namespace mystd
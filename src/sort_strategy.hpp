@@ -0,0 +1,13 @@
+#pragma once
+
+namespace mystd {
+
+enum class sort_strategy {
+    // in place bottom-up merge sort, O(1) extra space
+    merge,
+    // gathers the nodes into a contiguous buffer, sorts it and relinks
+    // the nodes, O(n) extra space but far fewer cache misses on large lists
+    gather
+};
+
+} //end namespace mystd
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "unrolled_forward_list_node.hpp"
+
+namespace mystd {
+
+template <typename T, std::size_t N, typename Allocator>
+class UnrolledForwardList;
+
+namespace detail {
+
+// Points to the element index of node. The before-begin iterator points to
+// the head of the list with the index before_first.
+template <bool IsConst, typename T, std::size_t N>
+class UnrolledFwdListIterator {
+    template<typename, std::size_t, typename Allocator>
+    friend class mystd::UnrolledForwardList;
+
+    friend class UnrolledFwdListIterator<true, T, N>;
+
+    using conditional = std::conditional_t<IsConst, const T, T>;
+    using NodeBase = UnrolledFwdListNodeBase<T, N>;
+    using Node = UnrolledFwdListNode<T, N>;
+
+    static constexpr std::size_t before_first = static_cast<std::size_t>(-1);
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = conditional *;
+    using reference = conditional &;
+    using iterator_category = typename std::forward_iterator_tag;
+
+    UnrolledFwdListIterator() : node_(nullptr), index_(0) {}
+
+    UnrolledFwdListIterator(const UnrolledFwdListIterator<false, T, N> &iterator)
+        : node_(iterator.node_), index_(iterator.index_) {}
+
+    UnrolledFwdListIterator &operator = (
+            const UnrolledFwdListIterator &iterator) = default;
+
+    UnrolledFwdListIterator &operator ++ ();
+    UnrolledFwdListIterator operator ++ (int);
+    reference operator * () const;
+    pointer operator -> () const;
+
+    bool operator == (const UnrolledFwdListIterator &rhs) const = default;
+
+private:
+    UnrolledFwdListIterator(NodeBase *node, std::size_t index)
+        : node_(node), index_(index) {}
+
+    Node *node() const { return static_cast<Node *>(node_); }
+    bool is_before_first() const { return index_ == before_first; }
+
+    NodeBase *node_;
+    std::size_t index_;
+};
+
+template <bool IsConst, typename T, std::size_t N>
+UnrolledFwdListIterator<IsConst, T, N> &
+UnrolledFwdListIterator<IsConst, T, N>::operator ++ () {
+    if(index_ == before_first || ++index_ == node()->size()) {
+        node_ = node_->next();
+        index_ = 0;
+    }
+
+    return *this;
+}
+
+template <bool IsConst, typename T, std::size_t N>
+UnrolledFwdListIterator<IsConst, T, N>
+UnrolledFwdListIterator<IsConst, T, N>::operator ++ (int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+}
+
+template <bool IsConst, typename T, std::size_t N>
+typename UnrolledFwdListIterator<IsConst, T, N>::reference
+    UnrolledFwdListIterator<IsConst, T, N>::operator * () const
+{
+    return node()->value(index_);
+}
+
+template <bool IsConst, typename T, std::size_t N>
+typename UnrolledFwdListIterator<IsConst, T, N>::pointer
+    UnrolledFwdListIterator<IsConst, T, N>::operator -> () const
+{
+    return &node()->value(index_);
+}
+
+} //end namespace detail
+} //end namespace mystd
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace mystd {
+namespace detail {
+
+// number of elements that keeps a node of the unrolled list within
+// one cache line, but at least 4 for large elements
+template <typename T>
+inline constexpr std::size_t unrolled_capacity = std::max<std::size_t>(
+        (64 - sizeof(void *) - alignof(T)) / sizeof(T), 4);
+
+template <typename T, std::size_t N>
+struct UnrolledFwdListNode;
+
+template <typename T, std::size_t N>
+struct UnrolledFwdListNodeBase {
+    UnrolledFwdListNodeBase(UnrolledFwdListNodeBase *next = nullptr)
+        : next_(next) {}
+
+    void setNext(UnrolledFwdListNodeBase *next) { next_ = next; }
+
+    UnrolledFwdListNode<T, N> *next() const {
+        return static_cast<UnrolledFwdListNode<T, N> *>(next_);
+    }
+
+private:
+    UnrolledFwdListNodeBase *next_;
+};
+
+// Node holding up to N elements in inline storage. Only the first size()
+// slots hold constructed elements, the node does not destroy them itself.
+template <typename T, std::size_t N>
+struct UnrolledFwdListNode : public UnrolledFwdListNodeBase<T, N> {
+private:
+    using Base = UnrolledFwdListNodeBase<T, N>;
+
+public:
+    using size_type = std::conditional_t<N <= UINT8_MAX, std::uint8_t,
+          std::conditional_t<N <= UINT16_MAX, std::uint16_t, std::uint32_t>>;
+
+    static constexpr std::size_t capacity = N;
+
+    UnrolledFwdListNode(Base *next = nullptr) : Base(next), size_(0) {}
+
+    std::size_t size() const { return size_; }
+    void setSize(std::size_t size) { size_ = static_cast<size_type>(size); }
+    bool full() const { return size_ == N; }
+
+    T *slot(std::size_t index) {
+        return reinterpret_cast<T *>(storage_ + index * sizeof(T));
+    }
+
+    T &value(std::size_t index) { return *std::launder(slot(index)); }
+    const T &value(std::size_t index) const {
+        return const_cast<UnrolledFwdListNode *>(this)->value(index);
+    }
+
+    // moves [index, size) one slot to the right, leaving index unconstructed
+    void open(std::size_t index);
+    // moves [index + 1, size) one slot to the left over the destroyed index
+    void close(std::size_t index);
+    // moves [index, size) to the end of other
+    void move_tail(std::size_t index, UnrolledFwdListNode &other);
+
+private:
+    size_type size_;
+    alignas(T) std::byte storage_[N * sizeof(T)];
+};
+
+template <typename T, std::size_t N>
+void UnrolledFwdListNode<T, N>::open(std::size_t index) {
+    for(std::size_t i = size_; i > index; --i) {
+        std::construct_at(slot(i), std::move(value(i - 1)));
+        std::destroy_at(slot(i - 1));
+    }
+
+    ++size_;
+}
+
+template <typename T, std::size_t N>
+void UnrolledFwdListNode<T, N>::close(std::size_t index) {
+    for(std::size_t i = index + 1; i < size_; ++i) {
+        std::construct_at(slot(i - 1), std::move(value(i)));
+        std::destroy_at(slot(i));
+    }
+
+    --size_;
+}
+
+template <typename T, std::size_t N>
+void UnrolledFwdListNode<T, N>::move_tail(
+        std::size_t index,
+        UnrolledFwdListNode &other)
+{
+    for(std::size_t i = index; i < size_; ++i) {
+        std::construct_at(other.slot(other.size_++), std::move(value(i)));
+        std::destroy_at(slot(i));
+    }
+
+    size_ = static_cast<size_type>(index);
+}
+
+} //end namespace detail
+} //end namespace mystd